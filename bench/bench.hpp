@@ -0,0 +1,291 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#define CT_STR_BENCH_TSC 1
+#else
+#define CT_STR_BENCH_TSC 0
+#endif
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace ct_str::bench
+{
+
+// Keep a value alive so the computation producing it is not optimized away
+template <typename T>
+inline void do_not_optimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	asm volatile("" : : "r,m"(value) : "memory");
+#else
+	static volatile const T* sink;
+	sink = &value;
+#endif
+}
+
+// Time fn() and return the best-of-runs nanoseconds per call. The iteration count is calibrated so that each
+// run takes at least min_run_ms.
+template <typename Fn>
+double ns_per_call(Fn&& fn, int runs = 5, double min_run_ms = 20.0)
+{
+	using clock = std::chrono::steady_clock;
+
+	// Warm up caches and branch predictors, and find an iteration count long enough to time
+	std::size_t iterations = 1;
+	for (;;)
+	{
+		auto start = clock::now();
+		for (std::size_t i = 0; i < iterations; ++i)
+			fn();
+		double ms = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+		if (ms >= min_run_ms || iterations >= (std::size_t{1} << 40))
+			break;
+		iterations *= 2;
+	}
+
+	double best = 0.0;
+	for (int r = 0; r < runs; ++r)
+	{
+		auto start = clock::now();
+		for (std::size_t i = 0; i < iterations; ++i)
+			fn();
+		double ns = std::chrono::duration<double, std::nano>(clock::now() - start).count() / iterations;
+		best	  = (r == 0) ? ns : std::min(best, ns);
+	}
+	return best;
+}
+
+inline void print_header(const char* title)
+{
+	std::printf("\n=== %s ===\n", title);
+	std::printf("%-28s %10s %12s %10s\n", "case", "bytes", "ns/call", "GB/s");
+}
+
+inline void print_row(const char* name, std::size_t bytes, double ns)
+{
+	std::printf("%-28s %10zu %12.2f %10.2f\n", name, bytes, ns, ns > 0.0 ? bytes / ns : 0.0);
+}
+
+// === PERCENTILE HARNESS ===
+//
+// measure() warms fn up, fixes an iteration count long enough to time, then takes a number of samples of that
+// many calls each and reports per-call percentiles over the samples. Samples are timed with the TSC where the
+// CPU has one (calibrated against steady_clock, i.e. clock_gettime on POSIX systems) and with steady_clock
+// otherwise. Report prints the results as a table, or as JSON with --json.
+
+struct Settings
+{
+	double		warmup_ms	  = 20.0;
+	std::size_t iterations	  = 0;	// calls per sample; 0 calibrates to min_sample_us
+	double		min_sample_us = 200.0;
+	int			samples		  = 51;
+	bool		tsc			  = CT_STR_BENCH_TSC != 0;
+	bool		json		  = false;
+	int			cpu			  = -1;	 // pin the thread to this CPU, where supported
+};
+
+struct Stats
+{
+	double		min	 = 0.0;	 // nanoseconds per call
+	double		p50	 = 0.0;
+	double		p90	 = 0.0;
+	double		p99	 = 0.0;
+	double		mean = 0.0;
+	std::size_t iterations = 0;
+	int			samples	   = 0;
+};
+
+// Nanoseconds per TSC tick, measured once against steady_clock
+inline double tsc_ns_per_tick()
+{
+#if CT_STR_BENCH_TSC
+	static const double ns_per_tick = []
+	{
+		using clock		 = std::chrono::steady_clock;
+		auto	 start	 = clock::now();
+		uint64_t t0		 = __rdtsc();
+		double	 elapsed = 0.0;
+		while (elapsed < 20e6)
+			elapsed = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+		return elapsed / static_cast<double>(__rdtsc() - t0);
+	}();
+	return ns_per_tick;
+#else
+	return 0.0;
+#endif
+}
+
+// Current time in nanoseconds on the selected clock; only differences are meaningful
+inline double now_ns(bool tsc)
+{
+#if CT_STR_BENCH_TSC
+	if (tsc)
+		return static_cast<double>(__rdtsc()) * tsc_ns_per_tick();
+#endif
+	(void)tsc;
+	return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+inline bool pin_to_cpu(int cpu)
+{
+#if defined(__linux__)
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	CPU_SET(cpu, &set);
+	return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+	(void)cpu;
+	return false;
+#endif
+}
+
+template <typename Fn>
+Stats measure(Fn&& fn, const Settings& settings = {})
+{
+	const bool tsc = settings.tsc;
+	if (tsc)
+		tsc_ns_per_tick();
+
+	std::size_t iterations = settings.iterations ? settings.iterations : 1;
+	for (double start = now_ns(tsc); now_ns(tsc) - start < settings.warmup_ms * 1e6;)
+		fn();
+	while (!settings.iterations && iterations < (std::size_t{1} << 40))
+	{
+		const double start = now_ns(tsc);
+		for (std::size_t i = 0; i < iterations; ++i)
+			fn();
+		if (now_ns(tsc) - start >= settings.min_sample_us * 1e3)
+			break;
+		iterations *= 2;
+	}
+
+	std::vector<double> per_call(static_cast<std::size_t>(std::max(settings.samples, 1)));
+	for (auto& ns : per_call)
+	{
+		const double start = now_ns(tsc);
+		for (std::size_t i = 0; i < iterations; ++i)
+			fn();
+		ns = (now_ns(tsc) - start) / static_cast<double>(iterations);
+	}
+	std::sort(per_call.begin(), per_call.end());
+
+	auto at = [&](double q)
+	{ return per_call[static_cast<std::size_t>(q * static_cast<double>(per_call.size() - 1))]; };
+	Stats stats;
+	stats.min		 = per_call.front();
+	stats.p50		 = at(0.50);
+	stats.p90		 = at(0.90);
+	stats.p99		 = at(0.99);
+	stats.iterations = iterations;
+	stats.samples	 = static_cast<int>(per_call.size());
+	for (double ns : per_call)
+		stats.mean += ns / static_cast<double>(per_call.size());
+	return stats;
+}
+
+// Reads --json, --tsc / --no-tsc, --iterations N, --samples N, --warmup-ms N and --cpu N
+inline Settings parse_settings(int argc, char** argv)
+{
+	Settings settings;
+	for (int i = 1; i < argc; ++i)
+	{
+		const bool		  has_value = i + 1 < argc;
+		const std::string arg		= argv[i];
+		if (arg == "--json")
+			settings.json = true;
+		else if (arg == "--tsc")
+			settings.tsc = CT_STR_BENCH_TSC != 0;
+		else if (arg == "--no-tsc")
+			settings.tsc = false;
+		else if (arg == "--iterations" && has_value)
+			settings.iterations = static_cast<std::size_t>(std::strtoull(argv[++i], nullptr, 10));
+		else if (arg == "--samples" && has_value)
+			settings.samples = std::atoi(argv[++i]);
+		else if (arg == "--warmup-ms" && has_value)
+			settings.warmup_ms = std::atof(argv[++i]);
+		else if (arg == "--cpu" && has_value)
+			settings.cpu = std::atoi(argv[++i]);
+		else
+			std::fprintf(stderr, "ignoring argument %s\n", arg.c_str());
+	}
+	if (settings.cpu >= 0 && !pin_to_cpu(settings.cpu))
+		std::fprintf(stderr, "could not pin to CPU %d\n", settings.cpu);
+	return settings;
+}
+
+class Report
+{
+public:
+	explicit Report(const Settings& settings)
+		: settings_(settings)
+	{
+		if (settings_.json)
+			std::printf("{\"timer\": \"%s\", \"results\": [", settings_.tsc ? "tsc" : "steady_clock");
+	}
+
+	~Report()
+	{
+		if (settings_.json)
+			std::printf("\n]}\n");
+	}
+
+	Report(const Report&)			 = delete;
+	Report& operator=(const Report&) = delete;
+
+	void group(const char* title)
+	{
+		group_ = title;
+		if (!settings_.json)
+		{
+			std::printf("\n=== %s ===\n", title);
+			std::printf("%-38s %10s %10s %10s %10s\n", "case", "min ns", "p50 ns", "p90 ns", "p99 ns");
+		}
+	}
+
+	template <typename Fn>
+	Stats run(const char* name, Fn&& fn)
+	{
+		const Stats stats = measure(fn, settings_);
+		if (settings_.json)
+		{
+			std::printf("%s\n  {\"group\": \"%s\", \"case\": \"%s\", \"min_ns\": %.3f, \"p50_ns\": %.3f, "
+						"\"p90_ns\": %.3f, \"p99_ns\": %.3f, \"mean_ns\": %.3f, \"iterations\": %zu, "
+						"\"samples\": %d}",
+						first_ ? "" : ",", group_.c_str(), name, stats.min, stats.p50, stats.p90, stats.p99, stats.mean,
+						stats.iterations, stats.samples);
+			first_ = false;
+		}
+		else
+			std::printf("%-38s %10.2f %10.2f %10.2f %10.2f\n", name, stats.min, stats.p50, stats.p90, stats.p99);
+		return stats;
+	}
+
+private:
+	Settings	settings_;
+	std::string group_;
+	bool		first_ = true;
+};
+
+}  // namespace ct_str::bench
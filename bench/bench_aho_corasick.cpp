@@ -0,0 +1,111 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+// aho_corasick against one std::string_view::find pass per pattern, counting every occurrence in 1 MiB of
+// synthetic log text, with 8 and 300 signatures.
+
+#include "bench.hpp"
+#include "ct_str.hpp"
+#include <cstddef>
+#include <random>
+#include <string>
+#include <string_view>
+
+// "p0" ... "p9", and so on up to 100 signatures per prefix
+#define AC_STR(x) AC_STR_(x)
+#define AC_STR_(x) #x
+#define AC_KEYS_10(p) \
+	AC_STR(p##0), AC_STR(p##1), AC_STR(p##2), AC_STR(p##3), AC_STR(p##4), AC_STR(p##5), AC_STR(p##6), AC_STR(p##7), \
+		AC_STR(p##8), AC_STR(p##9)
+#define AC_KEYS_100(p) \
+	AC_KEYS_10(p##0), AC_KEYS_10(p##1), AC_KEYS_10(p##2), AC_KEYS_10(p##3), AC_KEYS_10(p##4), AC_KEYS_10(p##5), \
+		AC_KEYS_10(p##6), AC_KEYS_10(p##7), AC_KEYS_10(p##8), AC_KEYS_10(p##9)
+
+#define LOG_SIGNATURES "ERROR", "FATAL", "panic:", "segfault", "Traceback", "OutOfMemory", "timed out", "refused"
+
+#define GENERATED_300 AC_KEYS_100(E_), AC_KEYS_100(Xerr), AC_KEYS_100(denied_)
+
+namespace
+{
+
+template <ct_str::FixedString... Patterns>
+struct SignatureSet
+{
+	using Automaton = ct_str::aho_corasick<Patterns...>;
+
+	static std::size_t naive(std::string_view text)
+	{
+		std::size_t count = 0;
+		for (std::size_t p = 0; p < Automaton::size(); ++p)
+		{
+			const std::string_view pattern = Automaton::pattern(p);
+			for (std::size_t pos = text.find(pattern); pos != std::string_view::npos; pos = text.find(pattern, pos + 1))
+				++count;
+		}
+		return count;
+	}
+
+	static std::size_t automaton(std::string_view text)
+	{
+		std::size_t count = 0;
+		Automaton::scan(text, [&](std::size_t, std::size_t) { ++count; });
+		return count;
+	}
+};
+
+// Log lines built from a small vocabulary, with a signature planted in about one line in 50
+template <typename Set>
+std::string make_log(std::size_t bytes)
+{
+	static constexpr const char* words[] = {"request", "handled", "in",	  "ms",	   "user", "id=",	"status", "200",
+											"GET",	   "/api/v1", "cache", "miss", "ok",   "retry", "worker", "INFO"};
+	std::mt19937 gen(7);
+	std::string	 text;
+	while (text.size() < bytes)
+	{
+		const int count = 4 + static_cast<int>(gen() % 8);
+		for (int w = 0; w < count; ++w)
+		{
+			text += words[gen() % 16];
+			text += ' ';
+		}
+		if (gen() % 50 == 0)
+			text += Set::Automaton::pattern(gen() % Set::Automaton::size());
+		text += '\n';
+	}
+	text.resize(bytes);
+	return text;
+}
+
+template <typename Set>
+void run(const char* title)
+{
+	const std::string	   log	= make_log<Set>(1 << 20);
+	const std::string_view text = log;
+
+	ct_str::bench::print_header(title);
+	auto measure = [&](const char* name, auto&& fn)
+	{
+		double ns = ct_str::bench::ns_per_call(
+			[&]
+			{
+				std::size_t count = fn(text);
+				ct_str::bench::do_not_optimize(count);
+			},
+			3);
+		ct_str::bench::print_row(name, text.size(), ns);
+	};
+	measure("string_view::find per pattern", &Set::naive);
+	measure("aho_corasick", &Set::automaton);
+}
+
+}  // namespace
+
+int main()
+{
+	run<SignatureSet<LOG_SIGNATURES>>("8 signatures, 1 MiB log");
+	run<SignatureSet<GENERATED_300>>("300 signatures, 1 MiB log");
+	return 0;
+}
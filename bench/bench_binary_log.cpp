@@ -0,0 +1,102 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+// The calling thread's cost of one log call: ct_str::binlog::log, which stores the message ID, a timestamp and the
+// raw arguments in a per-thread ring, against formatting the line on the spot with ct_str::format and snprintf
+// (without the write that would follow). The logger drains to bench_binary_log.ctlog while this runs; records it
+// had to drop because a ring filled are counted and printed at the end, since a dropped call costs less than a
+// stored one. The drain thread competes with the caller for a CPU on a single-core machine, which shows up in the
+// upper percentiles. Reports per-call percentiles; pass --json for machine-readable output.
+
+#include "bench.hpp"
+#include "details/binary_log.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string_view>
+
+namespace
+{
+
+struct Request
+{
+	std::string_view route;
+	uint32_t		 status;
+	int64_t			 micros;
+};
+
+const std::array<Request, 4> samples{{{"/index.html", 200, 42},
+									  {"/api/v1/users", 404, 1375},
+									  {"/static/app.js", 304, 7},
+									  {"/api/v1/orders", 500, 250003}}};
+
+template <typename Fn>
+auto cycling(Fn fn)
+{
+	return [fn, i = std::size_t{0}]() mutable
+	{
+		const Request& request = samples[i];
+		i					   = (i + 1) % samples.size();
+		fn(request);
+	};
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+	const ct_str::bench::Settings settings = ct_str::bench::parse_settings(argc, argv);
+	ct_str::bench::Report		  report(settings);
+
+	const char* path   = "bench_binary_log.ctlog";
+	auto&		logger = ct_str::binlog::Logger::instance();
+	ct_str::binlog::LoggerOptions options;
+	options.ring_bytes = std::size_t{1} << 24;
+	options.poll	   = std::chrono::microseconds(200);
+	if (!logger.start(path, options))
+	{
+		std::fprintf(stderr, "cannot open %s\n", path);
+		return 1;
+	}
+
+	auto binlog = [](const Request& r)
+	{ ct_str::binlog::log<"[INFO] {} -> {} in {} us">(r.route, r.status, r.micros); };
+	auto binlog_ints = [](const Request& r) { ct_str::binlog::log<"[INFO] status {} in {} us">(r.status, r.micros); };
+	auto ct_str_format = [](const Request& r)
+	{
+		char		buf[128];
+		std::size_t len = ct_str::format<"[INFO] {} -> {} in {} us">::write(buf, sizeof(buf), r.route, r.status,
+																			 r.micros);
+		ct_str::bench::do_not_optimize(len);
+		ct_str::bench::do_not_optimize(buf);
+	};
+	auto snprintf_format = [](const Request& r)
+	{
+		char buf[128];
+		int	 len = std::snprintf(buf, sizeof(buf), "[INFO] %.*s -> %u in %lld us", static_cast<int>(r.route.size()),
+								 r.route.data(), static_cast<unsigned>(r.status), static_cast<long long>(r.micros));
+		ct_str::bench::do_not_optimize(len);
+		ct_str::bench::do_not_optimize(buf);
+	};
+
+	report.group("log call: a string and two integers");
+	report.run("snprintf into a buffer", cycling(snprintf_format));
+	report.run("ct_str::format into a buffer", cycling(ct_str_format));
+	report.run("ct_str::binlog::log", cycling(binlog));
+	report.run("ct_str::binlog::log (integers only)", cycling(binlog_ints));
+	report.run("timestamp alone (binlog::ticks)", []
+			   {
+				   const uint64_t t = ct_str::binlog::ticks();
+				   ct_str::bench::do_not_optimize(t);
+			   });
+
+	logger.stop();
+	std::remove(path);
+	if (!settings.json)
+		std::printf("\nrecords dropped because a ring was full: %llu\n",
+					static_cast<unsigned long long>(logger.dropped()));
+	return 0;
+}
@@ -0,0 +1,77 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+// Runtime CRC-32 throughput: byte-at-a-time, slicing-by-8, slicing-by-16 and PCLMULQDQ folding on
+// 16 B, 1 KiB and 1 MiB buffers.
+
+#include "bench.hpp"
+#include "ct_str_runtime.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace
+{
+
+uint32_t crc32_bytewise(uint32_t crc, const std::byte* data, std::size_t len)
+{
+	crc = ~crc;
+	for (std::size_t i = 0; i < len; ++i)
+		crc = ct_str::crc32_tables.table[0][(crc ^ static_cast<uint8_t>(data[i])) & 0xFF] ^ (crc >> 8);
+	return ~crc;
+}
+
+uint32_t crc32_slicing8(uint32_t crc, const std::byte* data, std::size_t len)
+{
+	return ct_str::crc32_update(crc, data, len);
+}
+
+// Public entry point; always called with an initial CRC of 0
+uint32_t crc32_dispatched(uint32_t, const std::byte* data, std::size_t len)
+{
+	return ct_str::rt::crc32(std::span(data, len));
+}
+
+}  // namespace
+
+int main()
+{
+	struct Kernel
+	{
+		const char*				name;
+		ct_str::rt::Crc32Kernel fn;
+	};
+	std::vector<Kernel> kernels{
+		{"bytewise", &crc32_bytewise},
+		{"slicing-by-8", &crc32_slicing8},
+		{"slicing-by-16", &ct_str::rt::crc32_slicing16},
+	};
+#if CT_STR_X86_DISPATCH
+	if (ct_str::rt::cpu_features().pclmul && ct_str::rt::cpu_features().sse41)
+		kernels.push_back({"pclmul", &ct_str::rt::crc32_pclmul});
+#endif
+	kernels.push_back({"rt::crc32 (dispatched)", &crc32_dispatched});
+
+	std::vector<std::byte> buffer(1 << 20);
+	for (std::size_t i = 0; i < buffer.size(); ++i)
+		buffer[i] = static_cast<std::byte>(i * 131 + 7);
+
+	for (std::size_t size : {std::size_t{16}, std::size_t{1024}, std::size_t{1} << 20})
+	{
+		char title[64];
+		std::snprintf(title, sizeof(title), "crc32, %zu bytes", size);
+		ct_str::bench::print_header(title);
+		for (const auto& k : kernels)
+		{
+			double ns = ct_str::bench::ns_per_call(
+				[&]
+				{
+					uint32_t crc = k.fn(0, buffer.data(), size);
+					ct_str::bench::do_not_optimize(crc);
+				});
+			ct_str::bench::print_row(k.name, size, ns);
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,88 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+// finder against std::string_view::find, std::search, std::boyer_moore_horspool_searcher and memmem (where
+// the C library provides it) on HTTP-like text with the needle only at the end.
+
+#include "bench.hpp"
+#include "ct_str_runtime.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <string>
+#include <string_view>
+
+#if defined(__GLIBC__) || defined(__APPLE__) || defined(__FreeBSD__)
+#include <string.h>
+#define CT_STR_BENCH_MEMMEM 1
+#endif
+
+namespace
+{
+
+std::string make_haystack(std::size_t size, std::string_view needle)
+{
+	static constexpr const char* lines[] = {"GET /index.html HTTP/1.1\r\n", "Host: www.example.com\r\n",
+											"Accept: text/html,application/xhtml+xml\r\n", "Connection: keep-alive\r\n",
+											"User-Agent: bench/1.0 (X11; Linux x86_64)\r\n"};
+	std::mt19937 gen(9);
+	std::string	 hay;
+	while (hay.size() < size)
+		hay += lines[gen() % 5];
+	hay.resize(size - needle.size());
+	hay += needle;
+	return hay;
+}
+
+template <ct_str::FixedString Needle>
+void run(const char* title)
+{
+	const std::string_view needle(Needle.data, Needle.size());
+	ct_str::bench::print_header(title);
+	for (std::size_t size : {std::size_t{64}, std::size_t{4096}, std::size_t{1} << 20})
+	{
+		const std::string	   hay = make_haystack(size, needle);
+		const std::string_view view(hay);
+		const std::boyer_moore_horspool_searcher horspool(needle.begin(), needle.end());
+
+		auto measure = [&](const char* name, auto&& fn)
+		{
+			char label[64];
+			std::snprintf(label, sizeof(label), "%s %zu", name, size);
+			double ns = ct_str::bench::ns_per_call(
+				[&]
+				{
+					auto pos = fn();
+					ct_str::bench::do_not_optimize(pos);
+				});
+			ct_str::bench::print_row(label, size, ns);
+		};
+		measure("string_view::find", [&] { return view.find(needle); });
+		measure("std::search",
+				[&] { return std::search(view.begin(), view.end(), needle.begin(), needle.end()) - view.begin(); });
+		measure("horspool_searcher", [&] { return std::search(view.begin(), view.end(), horspool) - view.begin(); });
+#if CT_STR_BENCH_MEMMEM
+		measure("memmem",
+				[&]
+				{
+					const void* at = memmem(hay.data(), hay.size(), needle.data(), needle.size());
+					return static_cast<const char*>(at) - hay.data();
+				});
+#endif
+		measure("ct_str::finder", [&] { return ct_str::finder<Needle>::find(view); });
+	}
+}
+
+}  // namespace
+
+int main()
+{
+	run<"\r\n\r\n">("needle \"\\r\\n\\r\\n\"");
+	run<"Content-Length:">("needle \"Content-Length:\"");
+	run<"X-Request-Id: 0f8e2c1a-9b7d-4e3f">("32-byte needle");
+	return 0;
+}
@@ -0,0 +1,68 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+// ct_str::rt::to_chars and rt::to_chars_fixed against snprintf and std::to_chars, writing doubles of varied
+// magnitude into a stack buffer. "%g" keeps six digits and "%.17g" always round-trips; to_chars writes the shortest
+// text that round-trips. Reports per-call percentiles; pass --json for machine-readable output.
+
+#include "bench.hpp"
+#include "ct_str.hpp"
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdio>
+
+namespace
+{
+
+// Thresholds, coefficients and measurements of the kind found in config files and metrics
+const std::array<double, 8> samples{0.1, 2.5e-7, 3.14159265358979, 1234.5678, -0.000123, 6.02214076e23, 42.0, 0.75};
+
+template <typename Fn>
+auto cycling(Fn fn)
+{
+	return [fn, i = std::size_t{0}]() mutable
+	{
+		const double value = samples[i];
+		i				   = (i + 1) % samples.size();
+		char		buf[64];
+		std::size_t len = fn(buf, value);
+		ct_str::bench::do_not_optimize(len);
+		ct_str::bench::do_not_optimize(buf);
+	};
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+	const ct_str::bench::Settings settings = ct_str::bench::parse_settings(argc, argv);
+	ct_str::bench::Report		  report(settings);
+
+	auto g_snprintf = [](char* buf, double v) { return static_cast<std::size_t>(std::snprintf(buf, 64, "%g", v)); };
+	auto g17_snprintf = [](char* buf, double v)
+	{ return static_cast<std::size_t>(std::snprintf(buf, 64, "%.17g", v)); };
+	auto std_to_chars = [](char* buf, double v)
+	{ return static_cast<std::size_t>(std::to_chars(buf, buf + 64, v).ptr - buf); };
+	auto ct_str_to_chars = [](char* buf, double v)
+	{ return static_cast<std::size_t>(ct_str::rt::to_chars(buf, v) - buf); };
+	report.group("double, general format");
+	report.run("snprintf %g", cycling(g_snprintf));
+	report.run("snprintf %.17g", cycling(g17_snprintf));
+	report.run("std::to_chars", cycling(std_to_chars));
+	report.run("ct_str::rt::to_chars", cycling(ct_str_to_chars));
+
+	auto f_snprintf = [](char* buf, double v) { return static_cast<std::size_t>(std::snprintf(buf, 64, "%.3f", v)); };
+	auto std_fixed	= [](char* buf, double v)
+	{ return static_cast<std::size_t>(std::to_chars(buf, buf + 64, v, std::chars_format::fixed, 3).ptr - buf); };
+	// Every sample fits in the 64-byte buffer; fixed_max_length<double>(3) is the bound for any double
+	auto ct_str_fixed = [](char* buf, double v)
+	{ return static_cast<std::size_t>(ct_str::rt::to_chars_fixed(buf, v, 3) - buf); };
+	report.group("double, 3 digits after the point");
+	report.run("snprintf %.3f", cycling(f_snprintf));
+	report.run("std::to_chars fixed", cycling(std_fixed));
+	report.run("ct_str::rt::to_chars_fixed", cycling(ct_str_fixed));
+	return 0;
+}
@@ -0,0 +1,162 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+// ct_str::format against snprintf and, where the standard library has it, std::format_to_n, writing log lines
+// with string and integer arguments into a stack buffer, then ct_str::rt::to_chars against snprintf,
+// std::to_chars and std::ostringstream writing single integers. Reports per-call percentiles; pass --json for
+// machine-readable output.
+
+#include "bench.hpp"
+#include "ct_str.hpp"
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <version>
+#if defined(__cpp_lib_format)
+#include <format>
+#endif
+
+namespace
+{
+
+// Inputs cycled through by each case, so that digit counts and string lengths vary
+struct Sample
+{
+	std::string_view name;
+	int64_t			 micros;
+	uint32_t		 id;
+};
+
+const std::array<Sample, 8> samples{{{"parse", 42, 7},
+									 {"load_config", 1'250, 1'024},
+									 {"connect", -3, 65'535},
+									 {"handshake", 98'765'432, 3},
+									 {"query", 7, 4'294'967'295u},
+									 {"render_frame", 16'667, 88},
+									 {"flush", 0, 123'456},
+									 {"shutdown", 123'456'789'012, 9}}};
+
+template <typename Fn>
+auto cycling(Fn fn)
+{
+	return [fn, i = std::size_t{0}]() mutable
+	{
+		const Sample& sample = samples[i];
+		i					 = (i + 1) % samples.size();
+		char		buf[128];
+		std::size_t len = fn(buf, sample);
+		ct_str::bench::do_not_optimize(len);
+		ct_str::bench::do_not_optimize(buf);
+	};
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+	const ct_str::bench::Settings settings = ct_str::bench::parse_settings(argc, argv);
+	ct_str::bench::Report		  report(settings);
+
+	auto took_snprintf = [](char* buf, const Sample& s)
+	{
+		const int len = std::snprintf(buf, 128, "%.*s: took %lld us", static_cast<int>(s.name.size()), s.name.data(),
+									  static_cast<long long>(s.micros));
+		return static_cast<std::size_t>(len);
+	};
+	auto took_format = [](char* buf, const Sample& s)
+	{ return ct_str::format<"{}: took {} us">::write(buf, 128, s.name, s.micros); };
+	report.group("\"{}: took {} us\"");
+	report.run("snprintf", cycling(took_snprintf));
+#if defined(__cpp_lib_format)
+	auto took_std = [](char* buf, const Sample& s)
+	{ return static_cast<std::size_t>(std::format_to_n(buf, 128, "{}: took {} us", s.name, s.micros).size); };
+	report.run("std::format_to_n", cycling(took_std));
+#endif
+	report.run("ct_str::format", cycling(took_format));
+
+	auto request_snprintf = [](char* buf, const Sample& s)
+	{
+		const int len = std::snprintf(buf, 128, "[%s] request %u from %.*s finished in %lld us", "INFO", s.id,
+									  static_cast<int>(s.name.size()), s.name.data(), static_cast<long long>(s.micros));
+		return static_cast<std::size_t>(len);
+	};
+	auto request_format = [](char* buf, const Sample& s)
+	{
+		using Request = ct_str::format<"[{}] request {} from {} finished in {} us">;
+		return Request::write(buf, 128, "INFO", s.id, s.name, s.micros);
+	};
+	report.group("\"[{}] request {} from {} finished in {} us\"");
+	report.run("snprintf", cycling(request_snprintf));
+#if defined(__cpp_lib_format)
+	auto request_std = [](char* buf, const Sample& s)
+	{
+		auto result = std::format_to_n(buf, 128, "[{}] request {} from {} finished in {} us", "INFO", s.id, s.name,
+									   s.micros);
+		return static_cast<std::size_t>(result.size);
+	};
+	report.run("std::format_to_n", cycling(request_std));
+#endif
+	report.run("ct_str::format", cycling(request_format));
+
+	auto ids_snprintf = [](char* buf, const Sample& s)
+	{
+		const int len = std::snprintf(buf, 128, "id=%u t=%lld", s.id, static_cast<long long>(s.micros));
+		return static_cast<std::size_t>(len);
+	};
+	auto ids_format = [](char* buf, const Sample& s)
+	{ return ct_str::format<"id={} t={}">::write(buf, 128, s.id, s.micros); };
+	report.group("integers only: \"id={} t={}\"");
+	report.run("snprintf", cycling(ids_snprintf));
+#if defined(__cpp_lib_format)
+	auto ids_std = [](char* buf, const Sample& s)
+	{ return static_cast<std::size_t>(std::format_to_n(buf, 128, "id={} t={}", s.id, s.micros).size); };
+	report.run("std::format_to_n", cycling(ids_std));
+#endif
+	report.run("ct_str::format", cycling(ids_format));
+
+	auto hex_snprintf = [](char* buf, const Sample& s)
+	{ return static_cast<std::size_t>(std::snprintf(buf, 128, "%08x", s.id)); };
+	auto hex_ostream = [](char* buf, const Sample& s)
+	{
+		std::ostringstream out;
+		out << std::hex << std::setw(8) << std::setfill('0') << s.id;
+		const std::string text = out.str();
+		return static_cast<std::size_t>(text.copy(buf, 128));
+	};
+	auto hex_to_chars = [](char* buf, const Sample& s)
+	{
+		char		digits[8];
+		const auto	end = std::to_chars(digits, digits + 8, s.id, 16).ptr;
+		std::size_t len = static_cast<std::size_t>(end - digits);
+		std::fill_n(buf, 8 - len, '0');
+		std::copy(digits, end, buf + 8 - len);
+		return std::size_t{8};
+	};
+	auto hex_ct_str = [](char* buf, const Sample& s)
+	{ return static_cast<std::size_t>(ct_str::rt::to_chars<16>(buf, s.id, 8) - buf); };
+	report.group("uint32_t as 8 hex digits");
+	report.run("std::ostringstream", cycling(hex_ostream));
+	report.run("snprintf", cycling(hex_snprintf));
+	report.run("std::to_chars", cycling(hex_to_chars));
+	report.run("ct_str::rt::to_chars", cycling(hex_ct_str));
+
+	auto dec_snprintf = [](char* buf, const Sample& s)
+	{ return static_cast<std::size_t>(std::snprintf(buf, 128, "%lld", static_cast<long long>(s.micros))); };
+	auto dec_to_chars = [](char* buf, const Sample& s)
+	{ return static_cast<std::size_t>(std::to_chars(buf, buf + 128, s.micros).ptr - buf); };
+	auto dec_ct_str = [](char* buf, const Sample& s)
+	{ return static_cast<std::size_t>(ct_str::rt::to_chars(buf, s.micros) - buf); };
+	report.group("int64_t in decimal");
+	report.run("snprintf", cycling(dec_snprintf));
+	report.run("std::to_chars", cycling(dec_to_chars));
+	report.run("ct_str::rt::to_chars", cycling(dec_ct_str));
+	return 0;
+}
@@ -0,0 +1,197 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+// Lookups keyed by compile-time strings against std::string and std::unordered_map baselines: the ConfigEntry
+// pattern from use_case_config_keys (crc32 and perfect_map keys), view() comparisons, and the FileEntry
+// registry from use_case_file_registry. Reports per-call percentiles; pass --json for machine-readable output.
+
+#include "bench.hpp"
+#include "ct_str_runtime.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+
+// === CONFIGURATION KEYS (use_case_config_keys) ===
+
+using ConfigKeys = ct_str::perfect_map<"max_connections", "timeout_seconds", "buffer_size", "log_level">;
+
+std::array<int, ConfigKeys::size()> config_values{1, 2, 3, 4};
+
+template <ct_str::FixedString Key>
+struct ConfigEntry
+{
+	static constexpr auto		 hash  = ct_str::crc32<Key>();
+	static constexpr std::size_t index = ConfigKeys::index_of<Key>();
+
+	static int get() { return config_values[index]; }
+};
+
+const std::unordered_map<std::string, int> config_by_name{
+	{"max_connections", 1}, {"timeout_seconds", 2}, {"buffer_size", 3}, {"log_level", 4}};
+
+const std::unordered_map<uint32_t, int> config_by_hash{{ct_str::crc32<"max_connections">(), 1},
+													   {ct_str::crc32<"timeout_seconds">(), 2},
+													   {ct_str::crc32<"buffer_size">(), 3},
+													   {ct_str::crc32<"log_level">(), 4}};
+
+// === FILE REGISTRY (use_case_file_registry) ===
+
+#define PROJECT_FILES                                                                                              \
+	"include/ct_str.hpp", "src/main.cpp", "src/utils.cpp", "include/details/fixed_string.hpp", "scripts/build.py",  \
+		"README.md", "CMakeLists.txt"
+
+using ProjectPaths = ct_str::perfect_map<PROJECT_FILES>;
+
+template <ct_str::FixedString Path>
+struct FileEntry
+{
+	static constexpr auto filename = ct_str::filename<Path>::view();
+	static constexpr auto hash	   = ct_str::crc32<Path>();
+};
+
+// Inputs cycled through by each case: the keys in shuffled order plus about 10% misses
+std::vector<std::string> make_inputs(std::vector<std::string> keys, const char* miss)
+{
+	std::vector<std::string> inputs;
+	for (int round = 0; round < 16; ++round)
+	{
+		inputs.insert(inputs.end(), keys.begin(), keys.end());
+		if (round % 2 == 0)
+			inputs.push_back(miss);
+	}
+	std::shuffle(inputs.begin(), inputs.end(), std::mt19937(7));
+	return inputs;
+}
+
+// Calls fn with the next input on each call
+template <typename Fn>
+auto cycling(const std::vector<std::string>& inputs, Fn fn)
+{
+	return [&inputs, fn, i = std::size_t{0}]() mutable
+	{
+		const std::string& input = inputs[i];
+		i						 = i + 1 == inputs.size() ? 0 : i + 1;
+		auto result				 = fn(input);
+		ct_str::bench::do_not_optimize(result);
+	};
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+	const ct_str::bench::Settings settings = ct_str::bench::parse_settings(argc, argv);
+	ct_str::bench::Report		  report(settings);
+
+	const auto config_inputs =
+		make_inputs({"max_connections", "timeout_seconds", "buffer_size", "log_level"}, "max_conections");
+
+	report.group("config value by runtime name");
+	auto name_find = [](const std::string& name)
+	{
+		auto it = config_by_name.find(name);
+		return it == config_by_name.end() ? -1 : it->second;
+	};
+	auto hash_find = [](const std::string& name)
+	{
+		auto it = config_by_hash.find(ct_str::rt::crc32(name));
+		return it == config_by_hash.end() ? -1 : it->second;
+	};
+	auto perfect_find = [](const std::string& name)
+	{
+		const std::size_t index = ConfigKeys::find(name);
+		return index == ConfigKeys::npos ? -1 : config_values[index];
+	};
+	report.run("unordered_map<string>::find", cycling(config_inputs, name_find));
+	report.run("unordered_map<crc32> + rt::crc32", cycling(config_inputs, hash_find));
+	report.run("perfect_map::find", cycling(config_inputs, perfect_find));
+
+	// The key is known at compile time: ConfigEntry resolves it to an array slot
+	report.group("config value by compile-time key");
+	std::string timeout = "timeout_seconds";
+	report.run("unordered_map<string>::at",
+			   [&]
+			   {
+				   ct_str::bench::do_not_optimize(timeout);
+				   int value = config_by_name.at(timeout);
+				   ct_str::bench::do_not_optimize(value);
+			   });
+	report.run("unordered_map<crc32>::at(crc32<Key>)",
+			   [&]
+			   {
+				   int value = config_by_hash.at(ConfigEntry<"timeout_seconds">::hash);
+				   ct_str::bench::do_not_optimize(value);
+			   });
+	report.run("ConfigEntry<Key>::get",
+			   [&]
+			   {
+				   int value = ConfigEntry<"timeout_seconds">::get();
+				   ct_str::bench::do_not_optimize(value);
+			   });
+
+	report.group("equality with a known string");
+	const auto		  compare_inputs = make_inputs({"timeout_seconds", "timeout_minutes", "buffer_size"}, "");
+	const std::string expected		 = "timeout_seconds";
+	using Expected					 = ct_str::StringStore<"timeout_seconds">;
+	auto string_equal = [&](const std::string& s) { return s == expected; };
+	auto strcmp_equal = [](const std::string& s) { return std::strcmp(s.c_str(), Expected::c_str()) == 0; };
+	auto view_equal	  = [](const std::string& s) { return s == Expected::view(); };
+	report.run("std::string ==", cycling(compare_inputs, string_equal));
+	report.run("strcmp(c_str())", cycling(compare_inputs, strcmp_equal));
+	report.run("StringStore::view() ==", cycling(compare_inputs, view_equal));
+
+	const auto									 path_inputs = make_inputs({PROJECT_FILES}, "src/missing.cpp");
+	std::unordered_map<std::string, std::size_t> path_index;
+	for (std::size_t i = 0; i < ProjectPaths::size(); ++i)
+		path_index.emplace(std::string(ProjectPaths::key(i)), i);
+
+	report.group("file registry by runtime path");
+	auto map_find = [&](const std::string& path)
+	{
+		auto it = path_index.find(path);
+		return it == path_index.end() ? ProjectPaths::npos : it->second;
+	};
+	auto registry_find = [](const std::string& path) { return ProjectPaths::find(path); };
+	report.run("unordered_map<string>::find", cycling(path_inputs, map_find));
+	report.run("perfect_map::find", cycling(path_inputs, registry_find));
+
+	report.group("filename of a path");
+	auto filesystem_filename = [](const std::string& path)
+	{ return std::filesystem::path(path).filename().native().size(); };
+	auto rfind_filename = [](const std::string& path)
+	{
+		const std::string_view view(path);
+		return view.substr(view.rfind('/') + 1).size();
+	};
+	report.run("filesystem::path::filename", cycling(path_inputs, filesystem_filename));
+	report.run("string_view::rfind('/')", cycling(path_inputs, rfind_filename));
+	std::string main_cpp = "src/main.cpp";
+	report.run("string_view::rfind, known path",
+			   [&]
+			   {
+				   ct_str::bench::do_not_optimize(main_cpp);
+				   std::string_view view(main_cpp);
+				   auto				name = view.substr(view.rfind('/') + 1);
+				   ct_str::bench::do_not_optimize(name);
+			   });
+	report.run("FileEntry<Path>::filename",
+			   [&]
+			   {
+				   auto name = FileEntry<"src/main.cpp">::filename;
+				   ct_str::bench::do_not_optimize(name);
+			   });
+	return 0;
+}
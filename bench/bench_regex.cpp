@@ -0,0 +1,125 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+// regex against std::regex on request-validation patterns: whole-field match of short fields (mixed valid and
+// invalid) and a substring search over a 4 KiB request body.
+
+#include "bench.hpp"
+#include "ct_str.hpp"
+#include <cstddef>
+#include <random>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+
+template <ct_str::FixedString Pattern>
+void run_match(const char* title, const std::vector<std::string>& fields)
+{
+	const std::regex reference(Pattern.data, std::regex::optimize);
+	std::size_t		 bytes = 0;
+	for (const auto& f : fields)
+		bytes += f.size();
+	bytes /= fields.size();
+
+	ct_str::bench::print_header(title);
+	std::size_t next	= 0;
+	auto		measure = [&](const char* name, auto&& fn)
+	{
+		double ns = ct_str::bench::ns_per_call(
+			[&]
+			{
+				bool ok = fn(fields[next++ % fields.size()]);
+				ct_str::bench::do_not_optimize(ok);
+			});
+		ct_str::bench::print_row(name, bytes, ns);
+	};
+	measure("std::regex_match", [&](const std::string& s) { return std::regex_match(s, reference); });
+	measure("ct_str::regex::match", [](const std::string& s) { return ct_str::regex<Pattern>::match(s); });
+}
+
+template <ct_str::FixedString Pattern>
+void run_search(const char* title, const std::string& body)
+{
+	const std::regex reference(Pattern.data, std::regex::optimize);
+
+	ct_str::bench::print_header(title);
+	auto measure = [&](const char* name, auto&& fn)
+	{
+		double ns = ct_str::bench::ns_per_call(
+			[&]
+			{
+				bool found = fn(body);
+				ct_str::bench::do_not_optimize(found);
+			});
+		ct_str::bench::print_row(name, body.size(), ns);
+	};
+	measure("std::regex_search", [&](const std::string& s) { return std::regex_search(s, reference); });
+	measure("ct_str::regex::search", [](const std::string& s) { return ct_str::regex<Pattern>::search(s); });
+}
+
+// Valid fields produced by make_valid, with every fourth one corrupted at a random position
+template <typename Make>
+std::vector<std::string> make_fields(Make&& make_valid)
+{
+	std::mt19937			 gen(3);
+	std::vector<std::string> fields;
+	for (int i = 0; i < 1024; ++i)
+	{
+		std::string field = make_valid(gen);
+		if (i % 4 == 3)
+			field[gen() % field.size()] = '#';
+		fields.push_back(field);
+	}
+	return fields;
+}
+
+}  // namespace
+
+int main()
+{
+	auto identifiers = make_fields(
+		[](std::mt19937& gen)
+		{
+			std::string s(4 + gen() % 12, 'a');
+			for (auto& c : s)
+				c = static_cast<char>('a' + gen() % 26);
+			return s + "_" + std::to_string(100 + gen() % 900);
+		});
+	run_match<"[a-z]+_[0-9]{3}">("match [a-z]+_[0-9]{3}", identifiers);
+
+	auto uuids = make_fields(
+		[](std::mt19937& gen)
+		{
+			std::string s = "xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx";
+			for (auto& c : s)
+			{
+				if (c == 'x')
+					c = "0123456789abcdef"[gen() % 16];
+			}
+			return s;
+		});
+	run_match<"[0-9a-f]{8}-[0-9a-f]{4}-[0-9a-f]{4}-[0-9a-f]{4}-[0-9a-f]{12}">("match UUID", uuids);
+
+	auto emails = make_fields(
+		[](std::mt19937& gen)
+		{
+			static constexpr const char* users[]   = {"alice", "bob.smith", "carol+tag", "d_evans", "eve-99"};
+			static constexpr const char* domains[] = {"example.com", "mail.example.org", "corp.example.co.uk"};
+			return std::string(users[gen() % 5]) + "@" + domains[gen() % 3];
+		});
+	run_match<"[\\w.+-]+@[\\w-]+(\\.[\\w-]+)+">("match email", emails);
+
+	std::string	 body;
+	std::mt19937 gen(5);
+	while (body.size() < 4096)
+		body += "field" + std::to_string(gen() % 1000) + "=value&";
+	body += "token=ab12cd34ef56";
+	run_search<"token=[0-9a-f]{12}">("search 4 KiB body", body);
+	return 0;
+}
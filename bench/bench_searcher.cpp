@@ -0,0 +1,76 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+// searcher against std::string_view::find, std::search and std::boyer_moore_searcher on 1 MiB haystacks:
+// ordinary text, and adversarial inputs that drive naive search to O(n * m).
+
+#include "bench.hpp"
+#include "ct_str.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <string>
+#include <string_view>
+
+namespace
+{
+
+template <ct_str::FixedString Needle>
+void run(const char* title, const std::string& hay, bool backward = false)
+{
+	const std::string_view			needle(Needle.data, Needle.size());
+	const std::string_view			view(hay);
+	const std::boyer_moore_searcher boyer_moore(needle.begin(), needle.end());
+	using Searcher = ct_str::searcher<Needle>;
+
+	ct_str::bench::print_header(title);
+	auto measure = [&](const char* name, auto&& fn)
+	{
+		double ns = ct_str::bench::ns_per_call(
+			[&]
+			{
+				auto pos = fn();
+				ct_str::bench::do_not_optimize(pos);
+			},
+			3);
+		ct_str::bench::print_row(name, hay.size(), ns);
+	};
+	if (backward)
+	{
+		measure("string_view::rfind", [&] { return view.rfind(needle); });
+		measure("searcher::rfind", [&] { return Searcher::rfind(view); });
+		return;
+	}
+	measure("string_view::find", [&] { return view.find(needle); });
+	measure("std::search",
+			[&] { return std::search(view.begin(), view.end(), needle.begin(), needle.end()) - view.begin(); });
+	measure("boyer_moore_searcher", [&] { return std::search(view.begin(), view.end(), boyer_moore) - view.begin(); });
+	measure("searcher::find", [&] { return Searcher::find(view); });
+	measure("searcher::count", [&] { return Searcher::count(view); });
+}
+
+}  // namespace
+
+int main()
+{
+	constexpr std::size_t size = std::size_t{1} << 20;
+
+	std::string	 text;
+	std::mt19937 gen(4);
+	while (text.size() < size)
+		text += "field" + std::to_string(gen() % 100000) + "=value; ";
+	run<"Content-Length:">("text, needle absent", text);
+
+	const std::string as(size, 'a');
+	run<"aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaab">("a^n, needle a^31 b", as);
+	run<"baaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa">("a^n, needle b a^31, backward", as, true);
+
+	std::string ab;
+	while (ab.size() < size)
+		ab += "aaaaaaaaaaaaaaab";
+	run<"aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaab">("(a^15 b)^n, needle a^31 b", ab);
+	return 0;
+}
@@ -0,0 +1,115 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+// Runtime SHA-256: scalar and SHA-NI block kernels on single 64 B, 1 KiB and 1 MiB messages, then batches of
+// small messages one at a time versus the 8-lane AVX2 mode.
+
+#include "bench.hpp"
+#include "ct_str_runtime.hpp"
+#include <cstddef>
+#include <cstdio>
+#include <span>
+#include <vector>
+
+namespace
+{
+
+using Sha256Batch = void (*)(std::span<const std::span<const std::byte>>, std::span<ct_str::FixedBytes<32>>);
+
+// Scalar kernel through the same buffering and padding as rt::Sha256
+struct ScalarTraits : ct_str::Sha256Traits
+{
+	static void compress_blocks(uint32_t (&state)[8], const auto* data, std::size_t blocks)
+	{
+		ct_str::rt::sha256_blocks_scalar(state, reinterpret_cast<const std::byte*>(data), blocks);
+	}
+};
+
+void batch_scalar(std::span<const std::span<const std::byte>> messages, std::span<ct_str::FixedBytes<32>> digests)
+{
+	for (std::size_t i = 0; i < messages.size(); ++i)
+		digests[i] = ct_str::Sha2Engine<ScalarTraits>{}.update(messages[i].data(), messages[i].size()).finish();
+}
+
+}  // namespace
+
+int main()
+{
+	struct Kernel
+	{
+		const char*					  name;
+		ct_str::rt::Sha256BlockKernel fn;
+	};
+	std::vector<Kernel> kernels{{"scalar", &ct_str::rt::sha256_blocks_scalar}};
+#if CT_STR_X86_DISPATCH
+	if (ct_str::rt::cpu_features().sha && ct_str::rt::cpu_features().sse41)
+		kernels.push_back({"sha-ni", &ct_str::rt::sha256_blocks_shani});
+#endif
+
+	std::vector<std::byte> buffer(1 << 20);
+	for (std::size_t i = 0; i < buffer.size(); ++i)
+		buffer[i] = static_cast<std::byte>(i * 131 + 7);
+
+	// Whole blocks through each kernel, so the numbers isolate the compression function
+	for (std::size_t size : {std::size_t{64}, std::size_t{1024}, std::size_t{1} << 20})
+	{
+		char title[64];
+		std::snprintf(title, sizeof(title), "sha256 blocks, %zu bytes", size);
+		ct_str::bench::print_header(title);
+		for (const auto& k : kernels)
+		{
+			double ns = ct_str::bench::ns_per_call(
+				[&]
+				{
+					uint32_t state[8];
+					for (int i = 0; i < 8; ++i)
+						state[i] = ct_str::sha256_init[i];
+					k.fn(state, buffer.data(), size / 64);
+					ct_str::bench::do_not_optimize(state);
+				});
+			ct_str::bench::print_row(k.name, size, ns);
+		}
+	}
+
+	struct Batch
+	{
+		const char* name;
+		Sha256Batch fn;
+	};
+	std::vector<Batch> batches{
+		{"scalar, one at a time", &batch_scalar},
+		{"rt::sha256 one at a time", &ct_str::rt::sha256_batch_single},
+	};
+#if CT_STR_X86_DISPATCH
+	if (ct_str::rt::cpu_features().avx2)
+		batches.push_back({"avx2 8-lane", &ct_str::rt::sha256_batch_avx2});
+#endif
+	batches.push_back({"rt::sha256_batch", &ct_str::rt::sha256_batch});
+
+	// 256 messages per call, e.g. hashing a table of keys or fixed-size records
+	constexpr std::size_t count = 256;
+	for (std::size_t size : {std::size_t{16}, std::size_t{64}, std::size_t{256}})
+	{
+		std::vector<std::span<const std::byte>> messages;
+		for (std::size_t i = 0; i < count; ++i)
+			messages.push_back(std::span(buffer).subspan(i * size, size));
+		std::vector<ct_str::FixedBytes<32>> digests(count);
+
+		char title[64];
+		std::snprintf(title, sizeof(title), "sha256 batch of %zu x %zu bytes", count, size);
+		ct_str::bench::print_header(title);
+		for (const auto& b : batches)
+		{
+			double ns = ct_str::bench::ns_per_call(
+				[&]
+				{
+					b.fn(messages, digests);
+					ct_str::bench::do_not_optimize(digests.data());
+				});
+			ct_str::bench::print_row(b.name, size * count, ns);
+		}
+	}
+	return 0;
+}
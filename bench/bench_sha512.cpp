@@ -0,0 +1,81 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+// Runtime SHA-512: streaming throughput on large buffers, then batches of 8 to 4096 small records hashed one
+// at a time versus 4 lanes of AVX2 and 8 lanes of AVX-512.
+
+#include "bench.hpp"
+#include "ct_str_runtime.hpp"
+#include <cstddef>
+#include <cstdio>
+#include <span>
+#include <vector>
+
+namespace
+{
+
+using Sha512Batch = void (*)(std::span<const std::span<const std::byte>>, std::span<ct_str::FixedBytes<64>>);
+
+}  // namespace
+
+int main()
+{
+	std::vector<std::byte> buffer(1 << 20);
+	for (std::size_t i = 0; i < buffer.size(); ++i)
+		buffer[i] = static_cast<std::byte>(i * 131 + 7);
+
+	ct_str::bench::print_header("sha512 streaming");
+	for (std::size_t size : {std::size_t{1024}, std::size_t{1} << 20})
+	{
+		double ns = ct_str::bench::ns_per_call(
+			[&]
+			{
+				auto digest = ct_str::rt::sha512(std::span(buffer.data(), size));
+				ct_str::bench::do_not_optimize(digest);
+			});
+		ct_str::bench::print_row("rt::sha512", size, ns);
+	}
+
+	struct Batch
+	{
+		const char* name;
+		Sha512Batch fn;
+	};
+	std::vector<Batch> batches{{"one at a time", &ct_str::rt::sha512_batch_single}};
+#if CT_STR_X86_DISPATCH
+	if (ct_str::rt::cpu_features().avx2)
+		batches.push_back({"avx2 4-lane", &ct_str::rt::sha512_batch_avx2});
+	if (ct_str::rt::cpu_features().avx512f && ct_str::rt::cpu_features().avx512bw)
+		batches.push_back({"avx-512 8-lane", &ct_str::rt::sha512_batch_avx512});
+#endif
+	batches.push_back({"rt::sha512_batch", &ct_str::rt::sha512_batch});
+
+	// Dedup-key sized records: 64 bytes pads to one block, 200 bytes to two
+	for (std::size_t record : {std::size_t{64}, std::size_t{200}})
+	{
+		for (std::size_t count : {std::size_t{8}, std::size_t{64}, std::size_t{4096}})
+		{
+			std::vector<std::span<const std::byte>> messages;
+			for (std::size_t i = 0; i < count; ++i)
+				messages.push_back(std::span(buffer).subspan(i * record, record));
+			std::vector<ct_str::FixedBytes<64>> digests(count);
+
+			char title[64];
+			std::snprintf(title, sizeof(title), "sha512 batch of %zu x %zu bytes", count, record);
+			ct_str::bench::print_header(title);
+			for (const auto& b : batches)
+			{
+				double ns = ct_str::bench::ns_per_call(
+					[&]
+					{
+						b.fn(messages, digests);
+						ct_str::bench::do_not_optimize(digests.data());
+					});
+				ct_str::bench::print_row(b.name, record * count, ns);
+			}
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,126 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+// string_switch against an if/else chain of == compares, std::unordered_map and perfect_map, at 8, 64 and
+// 512 cases. Each call looks up the next key from a shuffled mix of hits and 10% misses.
+
+#include "bench.hpp"
+#include "ct_str.hpp"
+#include <cstddef>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// "p0" ... "p9", and so on up to 100 keys per prefix
+#define SW_STR(x) SW_STR_(x)
+#define SW_STR_(x) #x
+#define SW_KEYS_10(p) \
+	SW_STR(p##0), SW_STR(p##1), SW_STR(p##2), SW_STR(p##3), SW_STR(p##4), SW_STR(p##5), SW_STR(p##6), SW_STR(p##7), \
+		SW_STR(p##8), SW_STR(p##9)
+#define SW_KEYS_100(p) \
+	SW_KEYS_10(p##0), SW_KEYS_10(p##1), SW_KEYS_10(p##2), SW_KEYS_10(p##3), SW_KEYS_10(p##4), SW_KEYS_10(p##5), \
+		SW_KEYS_10(p##6), SW_KEYS_10(p##7), SW_KEYS_10(p##8), SW_KEYS_10(p##9)
+
+#define HTTP_METHODS "GET", "HEAD", "POST", "PUT", "DELETE", "CONNECT", "OPTIONS", "TRACE"
+
+#define REDIS_COMMANDS                                                                                               \
+	"GET", "SET", "DEL", "EXISTS", "EXPIRE", "TTL", "INCR", "DECR", "INCRBY", "DECRBY", "APPEND", "STRLEN", "MGET",  \
+		"MSET", "SETNX", "GETSET", "HGET", "HSET", "HDEL", "HEXISTS", "HGETALL", "HKEYS", "HVALS", "HLEN", "HINCRBY", \
+		"LPUSH", "RPUSH", "LPOP", "RPOP", "LLEN", "LRANGE", "LINDEX", "LSET", "LREM", "LTRIM", "SADD", "SREM",        \
+		"SMEMBERS", "SISMEMBER", "SCARD", "SPOP", "SUNION", "SINTER", "SDIFF", "ZADD", "ZREM", "ZRANGE", "ZSCORE",    \
+		"ZCARD", "ZRANK", "ZINCRBY", "ZCOUNT", "PING", "ECHO", "AUTH", "SELECT", "FLUSHDB", "FLUSHALL", "KEYS",        \
+		"SCAN", "TYPE", "RENAME", "MULTI", "EXEC"
+
+// 512 generated names of several lengths, with shared prefixes
+#define GENERATED_512                                                                                       \
+	SW_KEYS_100(get_), SW_KEYS_100(set_item_), SW_KEYS_100(list), SW_KEYS_100(stream_read_), SW_KEYS_100(x), \
+		SW_KEYS_10(flush_all_), "reset"
+
+namespace
+{
+
+template <ct_str::FixedString... Cases>
+struct CaseSet
+{
+	static constexpr std::string_view keys[] = {std::string_view(Cases.data, Cases.size())...};
+	static constexpr std::size_t	  count	 = sizeof...(Cases);
+
+	static std::size_t chain(std::string_view sv)
+	{
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			if (sv == keys[i])
+				return i;
+		}
+		return count;
+	}
+
+	static std::size_t dispatch(std::string_view sv) { return ct_str::string_switch<Cases...>(sv); }
+
+	static std::size_t perfect(std::string_view sv)
+	{
+		const std::size_t index = ct_str::perfect_map<Cases...>::find(sv);
+		return index == ct_str::perfect_map<Cases...>::npos ? count : index;
+	}
+};
+
+template <typename Set>
+void run(const char* title)
+{
+	std::unordered_map<std::string_view, std::size_t> map;
+	for (std::size_t i = 0; i < Set::count; ++i)
+		map.emplace(Set::keys[i], i);
+	auto lookup_map = [&](std::string_view sv)
+	{
+		auto it = map.find(sv);
+		return it == map.end() ? Set::count : it->second;
+	};
+
+	// Queries: every key several times plus 10% near misses, shuffled
+	std::vector<std::string> queries;
+	std::mt19937			 gen(1);
+	while (queries.size() < 4096)
+	{
+		std::string key(Set::keys[gen() % Set::count]);
+		if (gen() % 10 == 0)
+			key.back() ^= 0x20;
+		queries.push_back(key);
+	}
+	std::vector<std::string_view> views(queries.begin(), queries.end());
+	std::size_t					  bytes = 0;
+	for (auto v : views)
+		bytes += v.size();
+	bytes /= views.size();
+
+	ct_str::bench::print_header(title);
+	std::size_t next	= 0;
+	auto		measure = [&](const char* name, auto&& fn)
+	{
+		double ns = ct_str::bench::ns_per_call(
+			[&]
+			{
+				std::size_t index = fn(views[next++ & 4095]);
+				ct_str::bench::do_not_optimize(index);
+			});
+		ct_str::bench::print_row(name, bytes, ns);
+	};
+	measure("if/else chain", &Set::chain);
+	measure("std::unordered_map", lookup_map);
+	measure("string_switch", &Set::dispatch);
+	measure("perfect_map", &Set::perfect);
+}
+
+}  // namespace
+
+int main()
+{
+	run<CaseSet<HTTP_METHODS>>("8 cases (HTTP methods)");
+	run<CaseSet<REDIS_COMMANDS>>("64 cases (Redis commands)");
+	run<CaseSet<GENERATED_512>>("512 cases (generated names)");
+	return 0;
+}
@@ -0,0 +1,45 @@
+# Reports the .rodata, .data.rel.ro and .data sizes of the binaries in FILES, one line per binary, and
+# optionally appends them to the CSV file CSV.
+#
+# With STORES and MAX_PER_STORE, FILES must hold two builds of the same workload differing by STORES stores:
+# the check fails when the .rodata growth between them exceeds MAX_PER_STORE bytes per store.
+
+function(section_size file section out)
+	execute_process(COMMAND ${READELF} -S -W ${file} OUTPUT_VARIABLE sections RESULT_VARIABLE result)
+	if(NOT result EQUAL 0)
+		message(FATAL_ERROR "readelf failed on ${file}")
+	endif()
+	string(REPLACE "[ " "[" sections "${sections}")
+	set(size 0)
+	if(sections MATCHES "\\] ${section} +[A-Z_]+ +[0-9a-f]+ +[0-9a-f]+ +([0-9a-f]+)")
+		math(EXPR size "0x${CMAKE_MATCH_1}")
+	endif()
+	set(${out} ${size} PARENT_SCOPE)
+endfunction()
+
+string(REPLACE "," ";" FILES "${FILES}")
+set(rodata_sizes)
+foreach(file ${FILES})
+	get_filename_component(name ${file} NAME_WE)
+	section_size(${file} "\\.rodata" rodata)
+	section_size(${file} "\\.data\\.rel\\.ro" relro)
+	section_size(${file} "\\.data" data)
+	list(APPEND rodata_sizes ${rodata})
+	message(STATUS "${name}: .rodata ${rodata}, .data.rel.ro ${relro}, .data ${data}")
+	if(CSV)
+		if(NOT EXISTS ${CSV})
+			file(WRITE ${CSV} "binary,rodata,data_rel_ro,data\n")
+		endif()
+		file(APPEND ${CSV} "${name},${rodata},${relro},${data}\n")
+	endif()
+endforeach()
+
+if(STORES AND MAX_PER_STORE)
+	list(GET rodata_sizes 0 base)
+	list(GET rodata_sizes 1 grown)
+	math(EXPR per_store "(${grown} - ${base}) / ${STORES}")
+	message(STATUS ".rodata per store: ${per_store} bytes (limit ${MAX_PER_STORE})")
+	if(per_store GREATER MAX_PER_STORE)
+		message(FATAL_ERROR ".rodata grows by ${per_store} bytes per store, more than ${MAX_PER_STORE}")
+	endif()
+endif()
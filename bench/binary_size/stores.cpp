@@ -0,0 +1,75 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+// Binary-size workload: STORE_THOUSANDS thousand distinct StringStores, and a SHA-256 ByteStore with its hex()
+// string for the first thousand, each with every member ODR-used. Only the section sizes of the result matter.
+
+#include "ct_str.hpp"
+#include <cstddef>
+#include <cstdio>
+
+#ifndef STORE_THOUSANDS
+#define STORE_THOUSANDS 1
+#endif
+
+#define SIZE_STR(x) SIZE_STR_(x)
+#define SIZE_STR_(x) "catalog." #x ".message"
+#define SIZE_KEYS_10(p)                                                                                            \
+	SIZE_STR(p##0), SIZE_STR(p##1), SIZE_STR(p##2), SIZE_STR(p##3), SIZE_STR(p##4), SIZE_STR(p##5),               \
+		SIZE_STR(p##6), SIZE_STR(p##7), SIZE_STR(p##8), SIZE_STR(p##9)
+#define SIZE_KEYS_100(p)                                                                                           \
+	SIZE_KEYS_10(p##0), SIZE_KEYS_10(p##1), SIZE_KEYS_10(p##2), SIZE_KEYS_10(p##3), SIZE_KEYS_10(p##4),           \
+		SIZE_KEYS_10(p##5), SIZE_KEYS_10(p##6), SIZE_KEYS_10(p##7), SIZE_KEYS_10(p##8), SIZE_KEYS_10(p##9)
+#define SIZE_KEYS_1000(p)                                                                                          \
+	SIZE_KEYS_100(p##0), SIZE_KEYS_100(p##1), SIZE_KEYS_100(p##2), SIZE_KEYS_100(p##3), SIZE_KEYS_100(p##4),      \
+		SIZE_KEYS_100(p##5), SIZE_KEYS_100(p##6), SIZE_KEYS_100(p##7), SIZE_KEYS_100(p##8), SIZE_KEYS_100(p##9)
+
+namespace
+{
+
+template <ct_str::FixedString... Strs>
+struct Strings
+{
+	static constexpr const char*	   values[] = {ct_str::StringStore<Strs>::value...};
+	static constexpr const void*	   copies[] = {&ct_str::StringStore<Strs>::fwd...};
+	static constexpr std::string_view views[]  = {ct_str::StringStore<Strs>::view()...};
+};
+
+template <ct_str::FixedString... Strs>
+struct Digests
+{
+	static constexpr const uint8_t* values[] = {ct_str::sha256<Strs>::value...};
+	static constexpr const void*	copies[] = {&ct_str::sha256<Strs>::fwd...};
+	static const char* const		hex[];
+};
+
+template <ct_str::FixedString... Strs>
+const char* const Digests<Strs...>::hex[] = {ct_str::sha256<Strs>::hex()...};
+
+template <typename Table>
+std::size_t touch(std::size_t index)
+{
+	const std::size_t n = sizeof(Table::values) / sizeof(Table::values[0]);
+	std::printf("%p %p\n", static_cast<const void*>(Table::values[index % n]), Table::copies[index % n]);
+	return n;
+}
+
+}  // namespace
+
+int main(int argc, char**)
+{
+	using Thousand = Strings<SIZE_KEYS_1000(a)>;
+	std::size_t total = touch<Thousand>(argc) + Thousand::views[argc].size();
+#if STORE_THOUSANDS >= 2
+	total += touch<Strings<SIZE_KEYS_1000(b)>>(argc);
+#endif
+#if STORE_THOUSANDS >= 4
+	total += touch<Strings<SIZE_KEYS_1000(c)>>(argc) + touch<Strings<SIZE_KEYS_1000(d)>>(argc);
+#endif
+	using Hashes = Digests<SIZE_KEYS_1000(a)>;
+	total += touch<Hashes>(argc);
+	std::printf("%zu %s\n", total, Hashes::hex[argc]);
+	return 0;
+}
@@ -0,0 +1,523 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+// Compile-time benchmark driver.
+//
+// Generates translation units that instantiate a ct_str operation for a growing number of keys of a given
+// string length, runs each compiler on each one (syntax-only, so only front-end and constant-evaluation time is
+// measured) and reports how wall time and peak memory scale with the key count and the string length.
+// Results can also be written as CSV and JSON, and with --trace each TU is compiled once more with
+// -ftime-trace (Clang) or -ftime-report (GCC), leaving the traces next to the generated sources.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#define CT_BENCH_POSIX 1
+#else
+#define CT_BENCH_POSIX 0
+#endif
+
+namespace
+{
+
+struct Options
+{
+	std::vector<std::string> compilers{"c++"};
+	std::string				 std	 = "c++20";
+	std::string				 include = ".";
+	std::string				 out	 = ".";
+	std::vector<std::string> suites{"crc32", "crc32_rebuild"};
+	std::vector<std::size_t> counts{1, 10, 100, 1000, 5000};
+	std::vector<std::size_t> sizes{32};
+	std::size_t				 max_bytes = std::size_t{1} << 23;	// largest count * size to generate
+	int						 repeat	   = 3;
+	bool					 trace	   = false;
+	std::string				 csv;
+	std::string				 json;
+};
+
+struct Result
+{
+	std::string compiler;
+	std::string suite;
+	std::size_t size	   = 0;
+	std::size_t count	   = 0;
+	double		ms		   = 0.0;
+	double		per_key_us = 0.0;
+	long		peak_rss_kb = -1;  // -1 where the platform cannot report it
+	std::string status		= "ok";	 // or "compile_failed", with ms and per_key_us -1
+};
+
+// === TRANSLATION UNIT GENERATORS ===
+
+// i as a fixed-width base-62 field, so that every key of a given size has exactly that many characters. Distinct
+// for i below 62^4, which is well past any key count the benchmark can compile.
+constexpr std::size_t key_id_width = 4;
+
+std::string key_id(std::size_t i)
+{
+	static const char digits[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+	std::string		  id(key_id_width, '0');
+	for (std::size_t pos = key_id_width; pos-- > 0; i /= 62)
+		id[pos] = digits[i % 62];
+	return id;
+}
+
+// A padded, mixed-case path of exactly size characters, distinct for each i, that every suite can use:
+// "  /<id>/Part-Ab.cd/Part-Ab.cd/.../f.Txt  "
+constexpr std::size_t key_min_size = 3 + key_id_width + 8;
+
+std::string key_literal(std::size_t i, std::size_t size)
+{
+	const std::string head = "  /" + key_id(i);
+	const std::string tail = "/f.Txt  ";
+	std::string		  body;
+	const std::string part = "/Part-Ab.cd";
+	while (head.size() + body.size() + tail.size() < size)
+		body += part[body.size() % part.size()];
+	return "\"" + head + body + tail + "\"";
+}
+
+// Exactly size characters of HTML text, distinct for each i, in which about one character in five is one that HTML
+// escaping replaces: "<b><id>Fish & chips, <b>"fresh"</b> at Ann's. Fish & ...</b>"
+constexpr std::size_t markup_min_size = 3 + key_id_width + 4;
+
+std::string markup_literal(std::size_t i, std::size_t size)
+{
+	const std::string head = "<b>" + key_id(i);
+	const std::string tail = "</b>";
+	std::string		  body;
+	const std::string part = "Fish & chips, <b>\"fresh\"</b> at Ann's. ";
+	while (head.size() + body.size() + tail.size() < size)
+		body += part[body.size() % part.size()];
+
+	std::string literal = "\"";
+	for (const char c : head + body + tail)
+	{
+		if (c == '"' || c == '\\')
+			literal += '\\';
+		literal += c;
+	}
+	return literal + "\"";
+}
+
+// Reference: the original per-call table rebuild, kept here so both variants can be compared in one run
+const char* const crc32_rebuild_prelude = R"(
+consteval uint32_t crc32_rebuild(const char* data, std::size_t len)
+{
+	uint32_t table[256]{};
+	for (uint32_t i = 0; i < 256; ++i)
+	{
+		uint32_t crc = i;
+		for (uint32_t j = 0; j < 8; ++j)
+			crc = (crc & 1) ? ((crc >> 1) ^ 0xEDB88320) : (crc >> 1);
+		table[i] = crc;
+	}
+	uint32_t crc = 0xFFFFFFFF;
+	for (std::size_t i = 0; i < len; ++i)
+		crc = table[(crc ^ static_cast<uint8_t>(data[i])) & 0xFF] ^ (crc >> 8);
+	return crc ^ 0xFFFFFFFF;
+}
+
+template <ct_str::FixedString Str>
+consteval uint32_t crc32_ref()
+{
+	return crc32_rebuild(Str.data, Str.size());
+}
+)";
+
+// Each suite is one declaration per key: a type and an initializer with {} standing for the key literal, which
+// comes from key_literal unless the suite names another generator. Sizes below the generator's minimum are skipped.
+struct Suite
+{
+	const char* name;
+	const char* prelude;
+	const char* type;
+	const char* expression;
+	std::string (*key)(std::size_t i, std::size_t size) = key_literal;
+	std::size_t min_size								= key_min_size;
+};
+
+const Suite suites[] = {
+	{"crc32", "", "uint32_t", "ct_str::crc32<{}>()"},
+	{"crc32_rebuild", crc32_rebuild_prelude, "uint32_t", "crc32_ref<{}>()"},
+	{"sha256", "", "const uint8_t*", "ct_str::sha256<{}>::value"},
+	{"append", "", "const char*", "ct_str::append<{}, \"_suffix\">::value"},
+	{"replace_all", "", "const char*", "ct_str::replace_all<{}, \"-\", \"_\">::value"},
+	{"to_upper", "", "const char*", "ct_str::to_upper<{}>::value"},
+	{"trim", "", "const char*", "ct_str::trim<{}>::value"},
+	{"filename", "", "const char*", "ct_str::filename<{}>::value"},
+	// The same five-step chain as one pipe, and nested with a StringStore per step
+	{"pipe", "namespace op = ct_str::op;\n", "const char*",
+	 "ct_str::pipe<{}, op::trim, op::to_lower, op::replace_all<\"-\", \"_\">, op::replace_all<\".\", \"::\">, "
+	 "op::to_upper>::value"},
+	{"pipe_nested", "", "const char*",
+	 "ct_str::to_upper<ct_str::replace_all<ct_str::replace_all<ct_str::to_lower<ct_str::trim<{}>::fwd>::fwd, "
+	 "\"-\", \"_\">::fwd, \".\", \"::\">::fwd>::value"},
+	// HTML escaping of markup text as one replace_many, and as nested replace_alls ('&' first, so the '&'s that later
+	// steps insert are not escaped again)
+	{"replace_many", "using ct_str::pair;\n", "const char*",
+	 "ct_str::replace_many<{}, pair<\"&\", \"&amp;\">, pair<\"<\", \"&lt;\">, pair<\">\", \"&gt;\">, "
+	 "pair<\"\\\"\", \"&quot;\">, pair<\"'\", \"&#39;\">>::value",
+	 markup_literal, markup_min_size},
+	{"replace_all_nested", "", "const char*",
+	 "ct_str::replace_all<ct_str::replace_all<ct_str::replace_all<ct_str::replace_all<ct_str::replace_all<{}, "
+	 "\"&\", \"&amp;\">::fwd, \"<\", \"&lt;\">::fwd, \">\", \"&gt;\">::fwd, \"\\\"\", \"&quot;\">::fwd, "
+	 "\"'\", \"&#39;\">::value",
+	 markup_literal, markup_min_size},
+};
+
+const Suite* find_suite(const std::string& name)
+{
+	for (const auto& suite : suites)
+	{
+		if (name == suite.name)
+			return &suite;
+	}
+	return nullptr;
+}
+
+void generate(const Suite& suite, std::size_t count, std::size_t size, std::ostream& os)
+{
+	os << "#include \"ct_str.hpp\"\n" << suite.prelude;
+	const std::string expression = suite.expression;
+	const std::size_t hole		 = expression.find("{}");
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		os << "inline constexpr " << suite.type << " key_" << i << " = " << expression.substr(0, hole)
+		   << suite.key(i, size) << expression.substr(hole + 2) << ";\n";
+	}
+}
+
+// === MEASUREMENT ===
+
+bool is_clang(const std::string& compiler)
+{
+	return compiler.find("clang") != std::string::npos;
+}
+
+// Runs the command, optionally sending its stderr to a file; returns false if it fails. Where the platform
+// allows, peak_rss_kb receives the largest resident set of the command and the processes it waited for.
+bool run(const std::vector<std::string>& args, const std::string& stderr_path, long& peak_rss_kb)
+{
+	peak_rss_kb = -1;
+#if CT_BENCH_POSIX
+	const pid_t pid = fork();
+	if (pid < 0)
+		return false;
+	if (pid == 0)
+	{
+		if (!stderr_path.empty())
+		{
+			const int fd = open(stderr_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+			if (fd >= 0)
+				dup2(fd, 2);
+		}
+		std::vector<char*> argv;
+		for (const auto& arg : args)
+			argv.push_back(const_cast<char*>(arg.c_str()));
+		argv.push_back(nullptr);
+		execvp(argv[0], argv.data());
+		_exit(127);
+	}
+	int			  status = 0;
+	struct rusage usage{};
+	if (wait4(pid, &status, 0, &usage) != pid)
+		return false;
+#if defined(__APPLE__)
+	peak_rss_kb = static_cast<long>(usage.ru_maxrss / 1024);  // bytes on macOS
+#else
+	peak_rss_kb = static_cast<long>(usage.ru_maxrss);
+#endif
+	return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+#else
+	std::string cmd;
+	for (const auto& arg : args)
+		cmd += "\"" + arg + "\" ";
+	if (!stderr_path.empty())
+		cmd += "2> \"" + stderr_path + "\"";
+	return std::system(cmd.c_str()) == 0;
+#endif
+}
+
+std::vector<std::string> compile_args(const Options& opt, const std::string& compiler, const std::string& source)
+{
+	return {compiler, "-std=" + opt.std, "-fsyntax-only", "-I" + opt.include, source};
+}
+
+// Best wall time of opt.repeat runs, with the peak RSS of that run; ms < 0 if the compile fails
+Result time_compile(const Options& opt, const std::string& compiler, const std::string& source)
+{
+	Result best;
+	best.ms = -1.0;
+	for (int r = 0; r < opt.repeat; ++r)
+	{
+		long peak = -1;
+		auto start = std::chrono::steady_clock::now();
+		bool ok	   = run(compile_args(opt, compiler, source), "", peak);
+		auto stop  = std::chrono::steady_clock::now();
+		if (!ok)
+		{
+			std::cerr << "compile failed: " << compiler << " " << source << "\n";
+			best.ms = -1.0;
+			return best;
+		}
+		double ms = std::chrono::duration<double, std::milli>(stop - start).count();
+		if (best.ms < 0.0 || ms < best.ms)
+		{
+			best.ms			 = ms;
+			best.peak_rss_kb = peak;
+		}
+	}
+	return best;
+}
+
+// One more compile with the compiler's own phase timing: Clang writes <source>.json beside the object file,
+// GCC's report goes to <source>.time-report.txt
+void trace_compile(const Options& opt, const std::string& compiler, const std::string& source)
+{
+	const std::string stem = source.substr(0, source.rfind('.'));
+	long			  peak = -1;
+	if (is_clang(compiler))
+		run({compiler, "-std=" + opt.std, "-ftime-trace", "-c", "-I" + opt.include, source, "-o", stem + ".o"}, "",
+			peak);
+	else
+		run({compiler, "-std=" + opt.std, "-ftime-report", "-fsyntax-only", "-I" + opt.include, source},
+			stem + ".time-report.txt", peak);
+}
+
+// === REPORTS ===
+
+std::string compiler_label(const std::string& compiler)
+{
+	const std::size_t slash = compiler.find_last_of("/\\");
+	return slash == std::string::npos ? compiler : compiler.substr(slash + 1);
+}
+
+void write_csv(const std::string& path, const std::vector<Result>& results)
+{
+	std::ofstream os(path);
+	os << "compiler,suite,size,count,total_ms,per_key_us,peak_rss_kb,status\n";
+	for (const auto& r : results)
+	{
+		os << compiler_label(r.compiler) << "," << r.suite << "," << r.size << "," << r.count << "," << r.ms << ","
+		   << r.per_key_us << "," << r.peak_rss_kb << "," << r.status << "\n";
+	}
+}
+
+void write_json(const std::string& path, const std::vector<Result>& results)
+{
+	std::ofstream os(path);
+	os << "[\n";
+	for (std::size_t i = 0; i < results.size(); ++i)
+	{
+		const auto& r = results[i];
+		os << "  {\"compiler\": \"" << compiler_label(r.compiler) << "\", \"suite\": \"" << r.suite
+		   << "\", \"size\": " << r.size << ", \"count\": " << r.count << ", \"total_ms\": " << r.ms
+		   << ", \"per_key_us\": " << r.per_key_us << ", \"peak_rss_kb\": " << r.peak_rss_kb << ", \"status\": \""
+		   << r.status << "\"}"
+		   << (i + 1 < results.size() ? ",\n" : "\n");
+	}
+	os << "]\n";
+}
+
+// === COMMAND LINE ===
+
+std::vector<std::string> split(const std::string& list)
+{
+	std::vector<std::string> items;
+	std::stringstream		 ss(list);
+	std::string				 item;
+	while (std::getline(ss, item, ','))
+	{
+		if (!item.empty())
+			items.push_back(item);
+	}
+	return items;
+}
+
+std::vector<std::size_t> split_numbers(const std::string& list)
+{
+	std::vector<std::size_t> numbers;
+	for (const auto& item : split(list))
+		numbers.push_back(static_cast<std::size_t>(std::strtoull(item.c_str(), nullptr, 10)));
+	return numbers;
+}
+
+bool parse_args(int argc, char** argv, Options& opt)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		if (arg == "--trace")
+		{
+			opt.trace = true;
+			continue;
+		}
+		if (i + 1 >= argc)
+		{
+			std::cerr << "missing value for " << arg << "\n";
+			return false;
+		}
+		std::string value = argv[++i];
+		if (arg == "--cxx")
+			opt.compilers = split(value);
+		else if (arg == "--std")
+			opt.std = value;
+		else if (arg == "--include")
+			opt.include = value;
+		else if (arg == "--out")
+			opt.out = value;
+		else if (arg == "--suites")
+			opt.suites = split(value);
+		else if (arg == "--repeat")
+			opt.repeat = std::max(1, std::atoi(value.c_str()));
+		else if (arg == "--counts")
+			opt.counts = split_numbers(value);
+		else if (arg == "--sizes")
+			opt.sizes = split_numbers(value);
+		else if (arg == "--max-bytes")
+			opt.max_bytes = static_cast<std::size_t>(std::strtoull(value.c_str(), nullptr, 10));
+		else if (arg == "--csv")
+			opt.csv = value;
+		else if (arg == "--json")
+			opt.json = value;
+		else
+		{
+			std::cerr << "unknown option " << arg << "\n";
+			return false;
+		}
+	}
+	return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+	Options opt;
+	if (!parse_args(argc, argv, opt))
+	{
+		std::cerr << "usage: ct_compile_bench --cxx <compiler>[,<compiler>...] --include <dir> --out <dir>\n"
+					 "                        [--std c++20] [--suites crc32,crc32_rebuild] [--counts 1,10,100]\n"
+					 "                        [--sizes 32] [--max-bytes 8388608] [--repeat 3] [--trace]\n"
+					 "                        [--csv <file>] [--json <file>]\n"
+					 "suites:";
+		for (const auto& suite : suites)
+			std::cerr << " " << suite.name;
+		std::cerr << "\n";
+		return 2;
+	}
+
+	for (const auto& name : opt.suites)
+	{
+		if (!find_suite(name))
+		{
+			std::cerr << "unknown suite " << name << "\n";
+			return 2;
+		}
+	}
+
+	// A failed compile (a compiler running out of constexpr steps at the large end of a sweep, say) is recorded
+	// in its row and the sweep goes on, so that the reports still hold everything else
+	std::vector<Result> results;
+	bool				failed = false;
+	for (const auto& compiler : opt.compilers)
+	{
+		const std::string label = compiler_label(compiler);
+		for (const auto& name : opt.suites)
+		{
+			const Suite* suite = find_suite(name);
+
+			// Baseline: the header alone, subtracted so the per-key figure only reflects the operation itself
+			const std::string base_src = opt.out + "/" + name + "_0.cpp";
+			{
+				std::ofstream os(base_src);
+				generate(*suite, 0, 0, os);
+			}
+			Result base = time_compile(opt, compiler, base_src);
+			if (base.ms < 0.0)
+			{
+				// Every cell includes the header, so none of them can be measured either
+				base.compiler	= compiler;
+				base.suite		= name;
+				base.per_key_us = -1.0;
+				base.status		= "compile_failed";
+				results.push_back(base);
+				failed = true;
+				std::cout << "\n=== " << name << ", " << label << ": the header alone does not compile ===\n";
+				continue;
+			}
+
+			std::cout << "\n=== " << name << ", " << label << " (baseline " << base.ms << " ms) ===\n";
+			std::cout << "    size     keys     total ms    per-key us   peak RSS MiB\n";
+			for (std::size_t size : opt.sizes)
+			{
+				for (std::size_t count : opt.counts)
+				{
+					if (size < suite->min_size)
+					{
+						std::printf("%8zu %8zu      skipped (keys are at least %zu characters)\n", size, count,
+									suite->min_size);
+						continue;
+					}
+					if (count * size > opt.max_bytes)
+					{
+						std::printf("%8zu %8zu      skipped (over --max-bytes)\n", size, count);
+						continue;
+					}
+					const std::string src = opt.out + "/" + name + "_" + std::to_string(size) + "_" +
+											std::to_string(count) + ".cpp";
+					{
+						std::ofstream os(src);
+						generate(*suite, count, size, os);
+					}
+					Result r	= time_compile(opt, compiler, src);
+					r.compiler	= compiler;
+					r.suite		= name;
+					r.size		= size;
+					r.count		= count;
+					if (r.ms < 0.0)
+					{
+						r.per_key_us = -1.0;
+						r.status	 = "compile_failed";
+						results.push_back(r);
+						failed = true;
+						std::printf("%8zu %8zu      compile failed\n", size, count);
+						continue;
+					}
+					r.per_key_us = count ? (r.ms - base.ms) * 1000.0 / static_cast<double>(count) : 0.0;
+					results.push_back(r);
+					if (opt.trace)
+						trace_compile(opt, compiler, src);
+
+					char line[96];
+					std::snprintf(line, sizeof(line), "%8zu %8zu %12.1f %13.2f %14.1f\n", size, count, r.ms,
+								  r.per_key_us, r.peak_rss_kb < 0 ? 0.0 : static_cast<double>(r.peak_rss_kb) / 1024.0);
+					std::cout << line;
+				}
+			}
+		}
+	}
+
+	if (!opt.csv.empty())
+		write_csv(opt.csv, results);
+	if (!opt.json.empty())
+		write_json(opt.json, results);
+	return failed ? 1 : 0;
+}
@@ -0,0 +1,103 @@
+# Copyright 2025 by Kevin Hall.
+# BSD-3-Clause License - See ct_str.hpp for full license text.
+#
+# ct_str_embed(<target> [NAMESPACE <ns>] [CHUNK_SIZE <bytes>] [FILES <file>...] [TEXT <file>...])
+#
+# Generates a header for each file that exposes its contents as a ct_str::ByteStore (FILES) or
+# ct_str::StringStore (TEXT), along with its length, crc32, sha256 and a quoted ETag, all computed when the
+# header is generated.  The headers are regenerated when their file changes and are added to <target>, whose
+# sources include them as "<ns>/<name>.hpp", or all of them through "<ns>.hpp".  <name> is the file name made
+# into an identifier (web/index.html becomes index_html); <ns> defaults to assets.
+#
+# Each file is written as chunks of CHUNK_SIZE bytes (default 16384) that ct_str::embed_bytes/embed_text join
+# at compile time, which keeps every string literal and every constant-evaluation loop within compiler limits.
+# Joining still costs a few dozen operations per byte in a single evaluation, so for targets with assets beyond
+# a few hundred KiB the evaluation limits (-fconstexpr-ops-limit, -fconstexpr-steps) are raised to match.
+#
+#	include(cmake/CtStrEmbed.cmake)
+#	ct_str_embed(server TEXT web/index.html shaders/blit.frag FILES web/favicon.ico)
+#
+#	#include "assets.hpp"
+#	send(assets::index_html::data::view(), assets::index_html::etag::view());
+
+set(CT_STR_EMBED_ROOT ${CMAKE_CURRENT_LIST_DIR}/..)
+
+function(ct_str_embed target)
+	cmake_parse_arguments(PARSE_ARGV 1 ARG "" "NAMESPACE;CHUNK_SIZE" "FILES;TEXT")
+	if(ARG_UNPARSED_ARGUMENTS)
+		message(FATAL_ERROR "ct_str_embed: unexpected arguments ${ARG_UNPARSED_ARGUMENTS}")
+	endif()
+	if(NOT ARG_NAMESPACE)
+		set(ARG_NAMESPACE assets)
+	endif()
+	if(NOT ARG_CHUNK_SIZE)
+		set(ARG_CHUNK_SIZE 16384)
+	endif()
+
+	# The generator is a host tool built from this repository, using the library's runtime crc32 and sha256
+	if(NOT TARGET ct_str_embed_gen)
+		add_executable(ct_str_embed_gen ${CT_STR_EMBED_ROOT}/tools/ct_str_embed.cpp)
+		target_compile_features(ct_str_embed_gen PRIVATE cxx_std_20)
+		target_include_directories(ct_str_embed_gen PRIVATE ${CT_STR_EMBED_ROOT}/include)
+	endif()
+
+	set(out_dir ${CMAKE_CURRENT_BINARY_DIR}/ct_str_embed/${target})
+	file(MAKE_DIRECTORY ${out_dir}/${ARG_NAMESPACE})
+	set(headers)
+	set(names)
+	set(largest 0)
+	set(umbrella "// Generated by ct_str_embed; do not edit.\n\n#pragma once\n\n")
+
+	foreach(mode bytes text)
+		if(mode STREQUAL "bytes")
+			set(files ${ARG_FILES})
+		else()
+			set(files ${ARG_TEXT})
+		endif()
+		foreach(file ${files})
+			get_filename_component(source ${file} ABSOLUTE)
+			get_filename_component(file_name ${file} NAME)
+			file(RELATIVE_PATH path ${CMAKE_CURRENT_SOURCE_DIR} ${source})
+			string(MAKE_C_IDENTIFIER ${file_name} name)
+			if(name IN_LIST names)
+				message(FATAL_ERROR "ct_str_embed: more than one file for ${target} is named ${name}")
+			endif()
+			list(APPEND names ${name})
+			file(SIZE ${source} size)
+			if(size GREATER largest)
+				set(largest ${size})
+			endif()
+
+			set(header ${out_dir}/${ARG_NAMESPACE}/${name}.hpp)
+			add_custom_command(
+				OUTPUT ${header}
+				COMMAND ct_str_embed_gen --${mode} --name ${name} --namespace ${ARG_NAMESPACE} --path ${path}
+					--in ${source} --out ${header} --chunk ${ARG_CHUNK_SIZE}
+				DEPENDS ${source} ct_str_embed_gen
+				COMMENT "Embedding ${path}"
+				VERBATIM
+			)
+			list(APPEND headers ${header})
+			string(APPEND umbrella "#include \"${ARG_NAMESPACE}/${name}.hpp\"\n")
+		endforeach()
+	endforeach()
+
+	# The limits apply to each evaluation, so the largest asset sets them. GCC counts about 37 operations per
+	# byte (default limit 2^25), Clang and MSVC fewer steps (defaults 2^20 and 100000).
+	math(EXPR ops "${largest} * 48")
+	math(EXPR steps "${largest} * 16")
+	if(ops GREATER 33554432)
+		target_compile_options(${target} PRIVATE $<$<CXX_COMPILER_ID:GNU>:-fconstexpr-ops-limit=${ops}>)
+	endif()
+	if(steps GREATER 100000)
+		target_compile_options(${target} PRIVATE $<$<CXX_COMPILER_ID:MSVC>:/constexpr:steps${steps}>)
+	endif()
+	if(steps GREATER 1048576)
+		set(clang $<OR:$<CXX_COMPILER_ID:Clang>,$<CXX_COMPILER_ID:AppleClang>>)
+		target_compile_options(${target} PRIVATE $<${clang}:-fconstexpr-steps=${steps}>)
+	endif()
+
+	file(GENERATE OUTPUT ${out_dir}/${ARG_NAMESPACE}.hpp CONTENT "${umbrella}")
+	target_sources(${target} PRIVATE ${headers})
+	target_include_directories(${target} PRIVATE ${out_dir})
+endfunction()
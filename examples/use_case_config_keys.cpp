@@ -3,37 +3,48 @@ Copyright 2025 by Kevin Hall.
 BSD-3-Clause License - See ct_str.hpp for full license text.
 */
 
-#include "ct_str.hpp"
+#include "ct_str_runtime.hpp"
+#include <array>
 #include <iostream>
-#include <unordered_map>
+#include <string>
+
+// The complete set of configuration keys, hashed perfectly at compile time
+using ConfigKeys = ct_str::perfect_map<"max_connections", "timeout_seconds", "buffer_size", "log_level">;
+
+// One slot per key; no hashing, buckets or node allocation at runtime
+inline std::array<int, ConfigKeys::size()> config_values{};
 
 // Compile-time configuration system using ct_str
 template <ct_str::FixedString Key>
 struct ConfigEntry
 {
-	static constexpr auto key  = ct_str::StringStore<Key>();
-	static constexpr auto hash = ct_str::crc32<Key>();
+	static constexpr auto		 key   = ct_str::StringStore<Key>();
+	static constexpr auto		 hash  = ct_str::crc32<Key>();
+	static constexpr std::size_t index = ConfigKeys::index_of<Key>();
 
 	template <typename T>
 	static void set(T value)
 	{
-		get_storage()[hash] = value;
+		config_values[index] = value;
 	}
 
 	template <typename T>
 	static T get()
 	{
-		return get_storage()[hash];
-	}
-
-private:
-	static std::unordered_map<uint32_t, int>& get_storage()
-	{
-		static std::unordered_map<uint32_t, int> storage;
-		return storage;
+		return config_values[index];
 	}
 };
 
+// Set a value by a key name that only arrives at runtime (e.g. from a config file)
+bool set_by_name(std::string_view name, int value)
+{
+	const std::size_t index = ConfigKeys::find(name);
+	if (index == ConfigKeys::npos)
+		return false;
+	config_values[index] = value;
+	return true;
+}
+
 // Define configuration keys at compile time
 using MaxConnections = ConfigEntry<"max_connections">;
 using Timeout		 = ConfigEntry<"timeout_seconds">;
@@ -76,12 +87,25 @@ int main()
 	static_assert(ConfigEntry<"max_connections">::hash == MaxConnections::hash, "Same key should have same hash");
 	std::cout << "Key hashes are unique and deterministic!\n\n";
 
+	// Keys arriving at runtime hash to the same values
+	std::cout << "=== Runtime Key Lookup ===\n";
+	const std::string incoming	   = "timeout_seconds";
+	const uint32_t	  runtime_hash = ct_str::rt::crc32(incoming);
+	std::cout << "Runtime hash of '" << incoming << "': 0x" << std::hex << runtime_hash << std::dec << "\n";
+	std::cout << "Matches Timeout::hash: " << (runtime_hash == Timeout::hash ? "true" : "false") << "\n";
+
+	set_by_name(incoming, 45);
+	std::cout << "set_by_name(\"" << incoming << "\", 45) -> timeout_seconds: " << Timeout::get<int>() << "\n";
+	std::cout << "set_by_name(\"max_conections\", 1): " << (set_by_name("max_conections", 1) ? "set" : "unknown key")
+			  << "\n\n";
+
 	// Benefits of compile-time keys
 	std::cout << "=== Benefits ===\n";
 	std::cout << "- Keys are validated at compile time\n";
 	std::cout << "- No runtime string hashing overhead\n";
 	std::cout << "- Typos in key names cause compile errors\n";
 	std::cout << "- Keys can be used in constexpr contexts\n";
+	std::cout << "- Runtime lookups by name are one hash and one compare\n";
 
 	return 0;
 }
\ No newline at end of file
@@ -4,21 +4,46 @@ BSD-3-Clause License - See ct_str.hpp for full license text.
 */
 
 #include "ct_str.hpp"
+#include "details/binary_log.hpp"
 #include <chrono>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
+#include <iterator>
 #include <source_location>
+#include <string_view>
 
 // Compile-time log message formatter
 template <ct_str::FixedString Level, ct_str::FixedString Message>
 struct LogEntry
 {
-	// Format: [LEVEL] Message (file:line)
+	// Format: [LEVEL] Message, where each {} in the message is a runtime argument
 	using formatted = ct_str::append<"[", Level, "] ", Message>;
+	using format	= ct_str::format<formatted::fwd>;
 
 	static constexpr auto level			= Level;
 	static constexpr auto message		= ct_str::StringStore<Message>();
 	static constexpr auto formatted_msg = formatted::c_str();
 	static constexpr auto hash			= ct_str::crc32<Message>();
+
+	// The message ID as eight hex digits, spelled out at compile time
+	using hash_hex = ct_str::to_string<hash, 16, 8>;
+
+	// Argument count and types are checked at compile time; the line is built on the stack
+	template <typename... Args>
+	static void write(const Args&... args)
+	{
+		char line[256];
+		std::cout << format::format_to(line, args...) << "\n";
+	}
+
+	// Binary mode: the same line stored as a message ID, a timestamp and the raw arguments, formatted only when
+	// the log file is decoded
+	template <typename... Args>
+	static void record(const Args&... args)
+	{
+		ct_str::binlog::log<formatted::fwd>(args...);
+	}
 };
 
 // Log level tags
@@ -27,33 +52,52 @@ using WarnTag  = ct_str::StringStore<ct_str::FixedString("WARN")>;
 using ErrorTag = ct_str::StringStore<ct_str::FixedString("ERROR")>;
 using DebugTag = ct_str::StringStore<ct_str::FixedString("DEBUG")>;
 
-// Compile-time log functions
-template <ct_str::FixedString Message>
-void log_info()
+// Lowest level compiled in for each module: this file logs from DEBUG, "net" from WARN and everything else from INFO
+using Levels = ct_str::LogLevels<ct_str::LogLevel::info,
+								 ct_str::ModuleLevel<"use_case_logger", ct_str::LogLevel::debug>,
+								 ct_str::ModuleLevel<"net", ct_str::LogLevel::warn>>;
+
+// This file's module name, "use_case_logger"
+using this_module = ct_str::stem<__FILE__>;
+
+// A message below its module's floor is discarded at compile time; any other costs one atomic load
+template <ct_str::LogLevel Level,
+		  ct_str::FixedString Tag,
+		  ct_str::FixedString Message,
+		  ct_str::FixedString Module,
+		  typename... Args>
+void log_at(const Args&... args)
 {
-	using Entry = LogEntry<"INFO", Message>;
-	std::cout << Entry::formatted_msg << "\n";
+	if constexpr (Levels::compiled_in<Level, Module>)
+	{
+		if (Levels::enabled<Level, Module>())
+			LogEntry<Tag, Message>::write(args...);
+	}
 }
 
-template <ct_str::FixedString Message>
-void log_warn()
+// Compile-time log functions. Module defaults to the file these are defined in; pass another to log for it.
+template <ct_str::FixedString Message, ct_str::FixedString Module = this_module::fwd, typename... Args>
+void log_info(const Args&... args)
 {
-	using Entry = LogEntry<"WARN", Message>;
-	std::cout << Entry::formatted_msg << "\n";
+	log_at<ct_str::LogLevel::info, "INFO", Message, Module>(args...);
 }
 
-template <ct_str::FixedString Message>
-void log_error()
+template <ct_str::FixedString Message, ct_str::FixedString Module = this_module::fwd, typename... Args>
+void log_warn(const Args&... args)
 {
-	using Entry = LogEntry<"ERROR", Message>;
-	std::cout << Entry::formatted_msg << "\n";
+	log_at<ct_str::LogLevel::warn, "WARN", Message, Module>(args...);
 }
 
-template <ct_str::FixedString Message>
-void log_debug()
+template <ct_str::FixedString Message, ct_str::FixedString Module = this_module::fwd, typename... Args>
+void log_error(const Args&... args)
+{
+	log_at<ct_str::LogLevel::error, "ERROR", Message, Module>(args...);
+}
+
+template <ct_str::FixedString Message, ct_str::FixedString Module = this_module::fwd, typename... Args>
+void log_debug(const Args&... args)
 {
-	using Entry = LogEntry<"DEBUG", Message>;
-	std::cout << Entry::formatted_msg << "\n";
+	log_at<ct_str::LogLevel::debug, "DEBUG", Message, Module>(args...);
 }
 
 // Compile-time log message deduplication counter
@@ -82,16 +126,27 @@ int main()
 	log_debug<"Connection attempt #1">();
 	std::cout << "\n";
 
+	// Runtime arguments
+	std::cout << "=== Runtime Arguments ===\n";
+	const auto		 start = std::chrono::steady_clock::now();
+	std::string_view host  = "db-primary";
+	log_info<"Listening on port {}">(8080);
+	log_warn<"Retrying {} in {} ms (attempt {} of {})">(host, 250, 2, 5);
+	const auto elapsed = std::chrono::steady_clock::now() - start;
+	log_info<"Startup took {} us, cache enabled: {}">(
+		std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count(), true);
+	std::cout << "\n";
+
 	// Log message hashing
 	std::cout << "=== Log Message Hashing ===\n";
 	using Msg1 = LogEntry<"INFO", "Application started">;
 	using Msg2 = LogEntry<"ERROR", "Failed to connect to database">;
 
 	std::cout << "Message 1: '" << Msg1::message.view() << "'\n";
-	std::cout << "Hash:      0x" << std::hex << Msg1::hash << std::dec << "\n\n";
+	std::cout << "Hash:      0x" << Msg1::hash_hex::view() << "\n\n";
 
 	std::cout << "Message 2: '" << Msg2::message.view() << "'\n";
-	std::cout << "Hash:      0x" << std::hex << Msg2::hash << std::dec << "\n\n";
+	std::cout << "Hash:      0x" << Msg2::hash_hex::view() << "\n\n";
 
 	// Message deduplication
 	std::cout << "=== Message Deduplication ===\n";
@@ -100,18 +155,47 @@ int main()
 	for (int i = 0; i < 3; ++i)
 	{
 		LogCounter<repeated_msg::fwd>::increment();
-		std::cout << "[INFO] " << repeated_msg::c_str() << " (occurrence #" << LogCounter<repeated_msg::fwd>::get()
-				  << ")\n";
+		log_info<"{} (occurrence #{})">(repeated_msg::view(), LogCounter<repeated_msg::fwd>::get());
 	}
 	std::cout << "\n";
 
-	// Compile-time log filtering
-	std::cout << "=== Compile-Time Log Level Filtering ===\n";
-#ifdef ENABLE_DEBUG_LOGS
-	log_debug<"Debug logging is enabled">();
-#else
-	std::cout << "(Debug logs compiled out)\n";
-#endif
+	// Per-module log levels
+	std::cout << "=== Per-Module Log Levels ===\n";
+	log_debug<"Debug logging is compiled in for {}">(this_module::view());
+	log_info<"Connected to {}", "net">(host);  // below WARN: compiled out
+	log_warn<"Slow response from {}", "net">(host);
+	log_debug<"Cache miss for {}", "cache">(host);  // below INFO: compiled out
+
+	// Raising a level at runtime is one atomic store; lowering it stops at the module's floor
+	Levels::set_level<this_module::fwd>(ct_str::LogLevel::warn);
+	log_info<"Not shown: this module now logs from WARN">();
+	Levels::set_level("*", ct_str::LogLevel::trace);
+	log_debug<"Back to DEBUG for {}">(this_module::view());
+	std::cout << "\n";
+
+	// Binary logging
+	std::cout << "=== Binary Logging ===\n";
+	const char* log_path = "use_case_logger.ctlog";
+	auto&		binary	 = ct_str::binlog::Logger::instance();
+	if (binary.start(log_path))
+	{
+		for (int attempt = 1; attempt <= 3; ++attempt)
+			LogEntry<"WARN", "Retrying {} in {} ms (attempt {} of {})">::record(host, 250 * attempt, attempt, 3);
+		LogEntry<"INFO", "Connected to {} after {} s">::record(host, 1.5);
+		binary.stop();
+
+		// What tools/ct_str_log_decode prints, read back in-process
+		std::ifstream			  in(log_path, std::ios::binary);
+		ct_str::binlog::LogReader reader;
+		if (reader.parse(std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>())))
+		{
+			for (const auto& entry : reader.records())
+				std::cout << "+" << static_cast<long long>(reader.seconds(entry) * 1e6) << " us  " << reader.text(entry)
+						  << "\n";
+		}
+		in.close();
+		std::remove(log_path);
+	}
 	std::cout << "\n";
 
 	// Log message chaining
@@ -126,9 +210,11 @@ int main()
 	std::cout << "=== Performance Benefits ===\n";
 	std::cout << "- Log level tags deduplicated in binary\n";
 	std::cout << "- Message formatting done at compile time\n";
+	std::cout << "- Runtime arguments checked at compile time and written without allocating\n";
 	std::cout << "- No runtime string allocation\n";
-	std::cout << "- Messages can be filtered at compile time\n";
-	std::cout << "- Unique hashes enable fast log analysis\n\n";
+	std::cout << "- Levels below a module's floor are compiled out; the rest cost one atomic load\n";
+	std::cout << "- Unique hashes enable fast log analysis\n";
+	std::cout << "- Binary mode defers all formatting to the decoder\n\n";
 
 	// Compile-time verification
 	std::cout << "=== Compile-Time Verification ===\n";
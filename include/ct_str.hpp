@@ -26,6 +26,20 @@ THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "details/fixed_string.hpp"
 #include "details/string_store.hpp"
+#include "details/string_table.hpp"
 #include "details/string_fns.hpp"
+#include "details/pipe.hpp"
 #include "details/path_fns.hpp"
-#include "details/hash.hpp"
\ No newline at end of file
+#include "details/hash.hpp"
+#include "details/embed.hpp"
+#include "details/number_fns.hpp"
+#include "details/float_fns.hpp"
+#include "details/to_string.hpp"
+#include "details/format.hpp"
+#include "details/log_level.hpp"
+#include "details/perfect_map.hpp"
+#include "details/string_switch.hpp"
+#include "details/aho_corasick.hpp"
+#include "details/replace_many.hpp"
+#include "details/regex.hpp"
+#include "details/searcher.hpp"
@@ -0,0 +1,15 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#pragma once
+
+// The runtime kernels: CRC-32 and SHA-2 in ct_str::rt, and finder<Needle>. They bring in <immintrin.h>, CPU
+// feature detection and the SIMD code paths, which would slow down every translation unit that only needs the
+// compile-time library, so ct_str.hpp leaves them out.
+
+#include "ct_str.hpp"
+#include "details/rt_crc32.hpp"
+#include "details/rt_sha.hpp"
+#include "details/rt_find.hpp"
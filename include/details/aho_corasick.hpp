@@ -0,0 +1,262 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#pragma once
+
+#include "fixed_string.hpp"
+#include "key_pack.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace ct_str
+{
+
+// === TRIE CONSTRUCTION ===
+
+// Working trie for the consteval builder: children as sorted sibling lists, fail links and output links
+// computed breadth-first. order lists the nodes in BFS order, which becomes their final numbering.
+template <std::size_t MaxNodes>
+struct AhoCorasickTrie
+{
+	uint32_t	first_child[MaxNodes]{};
+	uint32_t	next_sibling[MaxNodes]{};
+	uint8_t		label[MaxNodes]{};
+	uint32_t	pattern[MaxNodes]{};  // index + 1 of the pattern ending here, or 0
+	uint32_t	fail[MaxNodes]{};
+	uint32_t	output[MaxNodes]{};	 // nearest node on the fail chain, including this one, that ends a pattern
+	uint32_t	order[MaxNodes]{};
+	std::size_t node_count = 1;
+	std::size_t duplicate  = static_cast<std::size_t>(-1);
+
+	constexpr uint32_t child(uint32_t node, uint8_t c) const
+	{
+		for (uint32_t n = first_child[node]; n != 0; n = next_sibling[n])
+		{
+			if (label[n] == c)
+				return n;
+		}
+		return 0;
+	}
+};
+
+template <auto... Patterns>
+consteval auto aho_corasick_trie()
+{
+	using CharT = typename std::remove_cvref_t<decltype(key_pack_first(Patterns...))>::value_type;
+
+	constexpr std::size_t lengths[] = {Patterns.size()...};
+	const CharT*		  data[]	= {Patterns.data...};
+
+	AhoCorasickTrie<key_pack_total(lengths) + 1> trie{};
+
+	for (std::size_t p = 0; p < sizeof...(Patterns); ++p)
+	{
+		uint32_t node = 0;
+		for (std::size_t i = 0; i < lengths[p]; ++i)
+		{
+			const uint8_t c		= static_cast<uint8_t>(data[p][i]);
+			uint32_t	  child = trie.child(node, c);
+			if (child == 0)
+			{
+				// New node, linked into the sibling list in label order
+				child			 = static_cast<uint32_t>(trie.node_count++);
+				trie.label[child] = c;
+				uint32_t* link	 = &trie.first_child[node];
+				while (*link != 0 && trie.label[*link] < c)
+					link = &trie.next_sibling[*link];
+				trie.next_sibling[child] = *link;
+				*link					 = child;
+			}
+			node = child;
+		}
+		if (trie.pattern[node] != 0)
+		{
+			trie.duplicate = p;
+			return trie;
+		}
+		trie.pattern[node] = static_cast<uint32_t>(p + 1);
+	}
+
+	// Breadth-first: a node's fail target is shallower, so its links are final before the node is reached
+	std::size_t tail = 1;
+	for (std::size_t head = 0; head < tail; ++head)
+	{
+		const uint32_t u = trie.order[head];
+		for (uint32_t v = trie.first_child[u]; v != 0; v = trie.next_sibling[v])
+		{
+			trie.order[tail++] = v;
+			uint32_t f		   = 0;
+			if (u != 0)
+			{
+				for (uint32_t g = trie.fail[u];; g = trie.fail[g])
+				{
+					f = trie.child(g, trie.label[v]);
+					if (f != 0 || g == 0)
+						break;
+				}
+			}
+			trie.fail[v]   = f;
+			trie.output[v] = trie.pattern[v] != 0 ? v : trie.output[f];
+		}
+	}
+	return trie;
+}
+
+// === AUTOMATON ===
+
+// Runtime layout, with nodes numbered breadth-first so the shallow nodes where most scanning happens share
+// cache lines. The root has a dense 256-entry transition row; every other node lists its edges, sorted by
+// label, in one shared edge array. A missing edge follows fail links until an edge or the root is found.
+template <typename CharT, std::size_t Nodes, std::size_t Count, std::size_t BlobSize>
+struct AhoCorasickTable
+{
+	using value_type = CharT;
+	using node_type	 = std::conditional_t<(Nodes <= 0xFFFF), uint16_t, uint32_t>;
+
+	node_type root[256]{};
+	uint32_t  edge_begin[Nodes + 1]{};	// edges of node n are [edge_begin[n], edge_begin[n + 1])
+	uint8_t	  edge_label[Nodes]{};
+	node_type edge_target[Nodes]{};
+	node_type fail[Nodes]{};
+	node_type output[Nodes]{};	// 0 when no pattern ends on this node's fail chain
+	uint32_t  pattern[Nodes]{};
+	uint32_t  offsets[Count + 1]{};	 // pattern i is blob[offsets[i]] .. blob[offsets[i + 1]]
+	CharT	  blob[BlobSize + 1]{};
+
+	constexpr node_type step(node_type node, uint8_t c) const
+	{
+		for (;;)
+		{
+			if (node == 0)
+				return root[c];
+			for (uint32_t e = edge_begin[node]; e < edge_begin[node + 1]; ++e)
+			{
+				if (edge_label[e] == c)
+					return edge_target[e];
+			}
+			node = fail[node];
+		}
+	}
+
+	template <typename Callback>
+	constexpr void scan(std::basic_string_view<CharT> text, Callback& callback) const
+	{
+		const std::size_t len  = text.size();
+		node_type		  node = 0;
+		for (std::size_t i = 0; i < len; ++i)
+		{
+			// At the root, skip bytes that cannot start a pattern
+			if (node == 0)
+			{
+				while (i < len && root[static_cast<uint8_t>(text[i])] == 0)
+					++i;
+				if (i == len)
+					break;
+			}
+			node = step(node, static_cast<uint8_t>(text[i]));
+			for (node_type m = output[node]; m != 0; m = output[fail[m]])
+			{
+				const std::size_t index = pattern[m] - 1;
+				callback(index, i + 1 - (offsets[index + 1] - offsets[index]));
+			}
+		}
+	}
+};
+
+template <auto... Patterns>
+consteval auto aho_corasick_logic()
+{
+	using CharT			   = typename std::remove_cvref_t<decltype(key_pack_first(Patterns...))>::value_type;
+	constexpr std::size_t n = sizeof...(Patterns);
+
+	constexpr bool same_char[] = {std::is_same_v<typename decltype(Patterns)::value_type, CharT>...};
+	static_assert(key_pack_all(same_char), "aho_corasick: all patterns must have the same character type");
+	static_assert(sizeof(CharT) == 1, "aho_corasick: patterns must use a byte-sized character type");
+
+	constexpr std::size_t lengths[] = {Patterns.size()...};
+	constexpr bool		  non_empty[] = {(Patterns.size() > 0)...};
+	static_assert(key_pack_all(non_empty), "aho_corasick: patterns must not be empty");
+
+	constexpr auto trie = aho_corasick_trie<Patterns...>();
+	static_assert(trie.duplicate == static_cast<std::size_t>(-1), "aho_corasick: duplicate pattern");
+
+	constexpr std::size_t nodes = trie.node_count;
+	using Table					= AhoCorasickTable<CharT, nodes, n, key_pack_total(lengths)>;
+	using node_type				= typename Table::node_type;
+	Table table{};
+
+	const CharT* data[] = {Patterns.data...};
+	for (std::size_t p = 0; p < n; ++p)
+	{
+		table.offsets[p + 1] = static_cast<uint32_t>(table.offsets[p] + lengths[p]);
+		for (std::size_t i = 0; i < lengths[p]; ++i)
+			table.blob[table.offsets[p] + i] = data[p][i];
+	}
+
+	// Renumber breadth-first
+	uint32_t rank[nodes]{};
+	for (std::size_t k = 0; k < nodes; ++k)
+		rank[trie.order[k]] = static_cast<uint32_t>(k);
+
+	for (uint32_t v = trie.first_child[0]; v != 0; v = trie.next_sibling[v])
+		table.root[trie.label[v]] = static_cast<node_type>(rank[v]);
+
+	uint32_t edge = 0;
+	for (std::size_t k = 0; k < nodes; ++k)
+	{
+		const uint32_t old	= trie.order[k];
+		table.edge_begin[k] = edge;
+		if (k != 0)
+		{
+			for (uint32_t v = trie.first_child[old]; v != 0; v = trie.next_sibling[v])
+			{
+				table.edge_label[edge]	= trie.label[v];
+				table.edge_target[edge] = static_cast<node_type>(rank[v]);
+				++edge;
+			}
+		}
+		table.fail[k]	 = static_cast<node_type>(rank[trie.fail[old]]);
+		table.output[k]	 = static_cast<node_type>(rank[trie.output[old]]);
+		table.pattern[k] = trie.pattern[old];
+	}
+	table.edge_begin[nodes] = edge;
+	return table;
+}
+
+// === AHO-CORASICK ===
+
+// Multi-pattern search with the automaton built at compile time. scan() calls callback(pattern_index, offset)
+// for every occurrence of every pattern, overlapping ones included, in order of the match's end position;
+// offset is where the match starts. Scanning allocates nothing and takes time linear in the text plus matches.
+//
+//	using Signatures = ct_str::aho_corasick<"ERROR", "panic:", "segfault">;
+//	Signatures::scan(line, [&](std::size_t pattern, std::size_t offset) { ... });
+template <FixedString... Patterns>
+struct aho_corasick
+{
+	static_assert(sizeof...(Patterns) > 0, "aho_corasick: at least one pattern is required");
+
+	static constexpr auto table = aho_corasick_logic<Patterns...>();
+
+	using CharT		 = typename decltype(table)::value_type;
+	using value_type = CharT;
+
+	static constexpr std::size_t size() { return sizeof...(Patterns); }
+
+	static constexpr std::basic_string_view<CharT> pattern(std::size_t index)
+	{
+		return {table.blob + table.offsets[index], table.offsets[index + 1] - table.offsets[index]};
+	}
+
+	template <typename Callback>
+	static constexpr void scan(std::basic_string_view<CharT> text, Callback&& callback)
+	{
+		table.scan(text, callback);
+	}
+};
+
+}  // namespace ct_str
@@ -0,0 +1,854 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#pragma once
+
+#include "cpu_features.hpp"
+#include "fixed_string.hpp"
+#include "format.hpp"
+#include "hash.hpp"
+#include "string_store.hpp"
+#include "to_string.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+// Binary logging: a call writes {message ID, timestamp, raw argument bytes} into a ring owned by the calling
+// thread, and a background thread copies the rings to a file. The format strings never pass through the hot path;
+// they are registered once per program, written to the file, and applied when the file is decoded (LogReader
+// below, or tools/ct_str_log_decode.cpp). Not included by ct_str.hpp, since it brings in threads and file I/O.
+
+namespace ct_str::binlog
+{
+
+// === ARGUMENT LAYOUT ===
+
+// One character per argument: b bool, c char, s/S int16/uint16, i/I int32/uint32, l/L int64/uint64, f float,
+// d double, z string (uint32 length, then the bytes). Values are stored in host byte order.
+template <typename T>
+consteval char arg_code()
+{
+	using U = std::remove_cvref_t<T>;
+	if constexpr (std::is_same_v<U, bool>)
+		return 'b';
+	else if constexpr (std::is_same_v<U, char>)
+		return 'c';
+	else if constexpr (std::is_same_v<U, float>)
+		return 'f';
+	else if constexpr (std::is_same_v<U, double>)
+		return 'd';
+	else if constexpr (std::is_integral_v<U> && (sizeof(U) == 2 || sizeof(U) == 4 || sizeof(U) == 8))
+		return "sSiIlL"[(sizeof(U) == 2 ? 0 : sizeof(U) == 4 ? 2 : 4) + std::is_unsigned_v<U>];
+	else if constexpr (std::is_convertible_v<const U&, std::string_view>)
+		return 'z';
+	else
+		return '?';
+}
+
+constexpr std::size_t arg_code_size(char code)
+{
+	switch (code)
+	{
+	case 'b':
+	case 'c':
+		return 1;
+	case 's':
+	case 'S':
+		return 2;
+	case 'i':
+	case 'I':
+	case 'f':
+	case 'z':  // the length; the bytes follow
+		return 4;
+	default:
+		return 8;
+	}
+}
+
+inline void copy_bytes(void* out, const void* src, std::size_t len)
+{
+	std::char_traits<char>::copy(static_cast<char*>(out), static_cast<const char*>(src), len);
+}
+
+template <typename T>
+inline std::size_t arg_size(const T& arg)
+{
+	if constexpr (arg_code<T>() == 'z')
+		return sizeof(uint32_t) + std::string_view(arg).size();
+	else
+		return sizeof(T);
+}
+
+template <typename T>
+inline std::byte* encode_arg(std::byte* out, const T& arg)
+{
+	if constexpr (arg_code<T>() == 'z')
+	{
+		const std::string_view str(arg);
+		const auto			   len = static_cast<uint32_t>(str.size());
+		copy_bytes(out, &len, sizeof(len));
+		copy_bytes(out + sizeof(len), str.data(), len);
+		return out + sizeof(len) + len;
+	}
+	else
+	{
+		copy_bytes(out, &arg, sizeof(T));
+		return out + sizeof(T);
+	}
+}
+
+// === MESSAGE TABLE ===
+
+// One format string with one argument layout, linked into the program's message list before main() runs
+struct MessageNode
+{
+	uint32_t		   id;
+	std::string_view   text;
+	std::string_view   layout;
+	const MessageNode* next = nullptr;
+
+	MessageNode(uint32_t message_id, std::string_view message_text, std::string_view message_layout);
+};
+
+// Newest first. Nodes are only ever added, so a reader can walk it while messages register.
+inline constinit std::atomic<const MessageNode*> message_list{nullptr};
+
+inline MessageNode::MessageNode(uint32_t message_id, std::string_view message_text, std::string_view message_layout)
+	: id(message_id), text(message_text), layout(message_layout)
+{
+	const MessageNode* head = message_list.load(std::memory_order_relaxed);
+	do
+		next = head;
+	while (!message_list.compare_exchange_weak(head, this, std::memory_order_release, std::memory_order_relaxed));
+}
+
+// IDs that two registered messages share with different text or layout. IDs are 32-bit hashes, so with tens of
+// thousands of messages a clash becomes possible; records with such an ID cannot be told apart, and the reader
+// shows them as ambiguous. A program can check this once at startup, or in a test.
+inline std::vector<uint32_t> colliding_message_ids()
+{
+	std::unordered_map<uint32_t, const MessageNode*> seen;
+	std::vector<uint32_t>							 ids;
+	for (const MessageNode* node = message_list.load(std::memory_order_acquire); node != nullptr; node = node->next)
+	{
+		const auto [it, added] = seen.try_emplace(node->id, node);
+		if (!added && (it->second->text != node->text || it->second->layout != node->layout) &&
+			std::find(ids.begin(), ids.end(), node->id) == ids.end())
+			ids.push_back(node->id);
+	}
+	return ids;
+}
+
+template <typename... Args>
+consteval auto layout_logic()
+{
+	constexpr char codes[] = {arg_code<Args>()..., '\0'};
+	return FixedString<char, sizeof...(Args) + 1>(codes, sizeof...(Args));
+}
+
+// crc32 of the format text and the layout, so one message logged with different argument types gets one ID per
+// layout. 0 marks padding in the rings and is never used.
+template <FixedString Fmt, typename... Args>
+consteval uint32_t message_id_logic()
+{
+	constexpr auto layout = layout_logic<Args...>();
+	constexpr char separator[] = {'\0'};
+	uint32_t	   crc		   = crc32_update(0, Fmt.data, Fmt.size());
+	crc						   = crc32_update(crc, separator, 1);
+	crc						   = crc32_update(crc, layout.data, layout.size());
+	return crc == 0 ? 1 : crc;
+}
+
+template <FixedString Fmt, typename... Args>
+struct Message
+{
+	using text	 = StringStore<Fmt>;
+	using layout = StringStore<layout_logic<Args...>()>;
+
+	static constexpr uint32_t id = message_id_logic<Fmt, Args...>();
+
+	static inline MessageNode node{id, text::view(), layout::view()};
+};
+
+// === PER-THREAD RING ===
+
+// Records are 8-byte aligned: this header, the encoded arguments, then padding
+struct RecordHeader
+{
+	uint32_t id;
+	uint32_t size;  // argument bytes
+	uint64_t time;  // ticks()
+};
+
+constexpr std::size_t record_bytes(std::size_t payload)
+{
+	return (sizeof(RecordHeader) + payload + 7) & ~std::size_t{7};
+}
+
+// Timestamps: the TSC where there is one, otherwise steady_clock nanoseconds. Logger::start() records how many
+// ticks make a second.
+inline uint64_t ticks()
+{
+#if CT_STR_X86_DISPATCH
+	return __rdtsc();
+#else
+	return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+// Single-producer, single-consumer byte ring. A record never wraps: one that does not fit before the end of the
+// buffer leaves a padding marker (an ID of 0) and starts again at the front. The producer keeps its own copy of
+// the consumer's position and reloads it only when the ring looks full.
+class Ring
+{
+public:
+	// The buffer is zeroed here so that its pages are not first touched by a log call
+	Ring(std::size_t capacity, uint32_t thread_index)
+		: data_(new std::byte[capacity]()), capacity_(capacity), thread_index_(thread_index)
+	{
+	}
+
+	uint32_t thread_index() const { return thread_index_; }
+
+	// Producer: room for bytes (a multiple of 8), or nullptr if the ring is full
+	std::byte* reserve(std::size_t bytes)
+	{
+		std::size_t		  offset = write_pos_ & (capacity_ - 1);
+		const std::size_t room	 = capacity_ - offset;
+		const std::size_t skip	 = bytes <= room ? 0 : room;
+		if (write_pos_ + skip + bytes - cached_tail_ > capacity_)
+		{
+			cached_tail_ = tail_.load(std::memory_order_acquire);
+			if (write_pos_ + skip + bytes - cached_tail_ > capacity_)
+				return nullptr;
+		}
+		if (skip != 0)
+		{
+			const uint32_t padding = 0;
+			copy_bytes(data_.get() + offset, &padding, sizeof(padding));
+			write_pos_ += skip;
+			offset = 0;
+		}
+		return data_.get() + offset;
+	}
+
+	// Producer: publishes the record written at the last reserve()
+	void commit(std::size_t bytes)
+	{
+		write_pos_ += bytes;
+		head_.store(write_pos_, std::memory_order_release);
+	}
+
+	// Producer: counts a record lost to a full ring
+	void drop() { dropped_.store(dropped_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed); }
+
+	// Consumer: passes each contiguous run of published records to write(data, size) and frees them
+	template <typename Write>
+	std::size_t drain(Write&& write)
+	{
+		const uint64_t head	 = head_.load(std::memory_order_acquire);
+		const uint64_t start = tail_.load(std::memory_order_relaxed);
+		uint64_t	   tail	 = start;
+		while (tail != head)
+		{
+			const std::size_t offset = tail & (capacity_ - 1);
+			const std::size_t room	 = capacity_ - offset;
+			const std::size_t limit	 = head - tail < room ? head - tail : room;
+			std::size_t		  run	 = 0;
+			while (run < limit)
+			{
+				// Padding may sit in the last 8 bytes of the buffer, so only its ID is read
+				uint32_t id;
+				copy_bytes(&id, data_.get() + offset + run, sizeof(id));
+				if (id == 0)
+					break;
+				RecordHeader header;
+				copy_bytes(&header, data_.get() + offset + run, sizeof(header));
+				run += record_bytes(header.size);
+			}
+			if (run != 0)
+				write(data_.get() + offset, run);
+			tail += run < limit ? room : run;
+		}
+		tail_.store(tail, std::memory_order_release);
+		return tail - start;
+	}
+
+	uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+	bool	 empty() const { return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_relaxed); }
+	void	 close() { closed_.store(true, std::memory_order_release); }
+	bool	 closed() const { return closed_.load(std::memory_order_acquire); }
+
+	// Consumer: drops counted since the last call
+	uint64_t take_new_drops()
+	{
+		const uint64_t total = dropped();
+		const uint64_t fresh = total - reported_drops_;
+		reported_drops_		 = total;
+		return fresh;
+	}
+
+private:
+	std::unique_ptr<std::byte[]> data_;
+	std::size_t					 capacity_;
+	uint32_t					 thread_index_;
+	uint64_t					 reported_drops_ = 0;
+	std::atomic<bool>			 closed_{false};
+
+	alignas(64) std::atomic<uint64_t> head_{0};
+	uint64_t			  write_pos_   = 0;
+	uint64_t			  cached_tail_ = 0;
+	std::atomic<uint64_t> dropped_{0};
+
+	alignas(64) std::atomic<uint64_t> tail_{0};
+};
+
+// === FILE FORMAT ===
+
+// A file is a FileHeader followed by chunks, each a ChunkHeader and size bytes. Values are in the writer's byte
+// order, which byte_order records.
+struct FileHeader
+{
+	char	 magic[8]		  = {'C', 'T', 'S', 'T', 'R', 'L', 'O', 'G'};
+	uint32_t version		  = 1;
+	uint32_t byte_order		  = 0x01020304;
+	uint64_t start_ticks	  = 0;
+	uint64_t ticks_per_second = 0;
+	int64_t	 start_unix_ns	  = 0;  // system_clock at start_ticks
+};
+
+enum class ChunkKind : uint32_t
+{
+	messages = 1,  // {uint32 id, uint32 text size, uint32 layout size, text, layout}...
+	records	 = 2,  // records of one thread, as they were in its ring
+	dropped	 = 3,  // uint64: records one thread lost to a full ring
+};
+
+struct ChunkHeader
+{
+	ChunkKind kind;
+	uint32_t  thread;
+	uint64_t  size;
+};
+
+// === LOGGER ===
+
+struct LoggerOptions
+{
+	std::size_t				  ring_bytes = std::size_t{1} << 20;  // per thread; a power of two
+	std::chrono::microseconds poll		 = std::chrono::microseconds(1000);
+};
+
+// Owns the rings and the thread that drains them. Threads get a ring on their first call, whether or not the
+// logger has been started; records that do not fit are dropped and counted, never waited for.
+class Logger
+{
+public:
+	static Logger& instance()
+	{
+		static Logger logger;
+		return logger;
+	}
+
+	Logger()						 = default;
+	Logger(const Logger&)			 = delete;
+	Logger& operator=(const Logger&) = delete;
+	~Logger() { stop(); }
+
+	// Opens path and starts draining into it; false if the file cannot be opened or the logger is running
+	bool start(const std::string& path, const LoggerOptions& options = {})
+	{
+		std::lock_guard<std::mutex> lock(control_);
+		if (file_ != nullptr || (options.ring_bytes & (options.ring_bytes - 1)) != 0 || options.ring_bytes < 4096)
+			return false;
+		file_ = std::fopen(path.c_str(), "wb");
+		if (file_ == nullptr)
+			return false;
+		std::setvbuf(file_, nullptr, _IOFBF, std::size_t{1} << 16);
+		{
+			std::lock_guard<std::mutex> rings_lock(mutex_);
+			options_ = options;
+		}
+		written_through_ = nullptr;
+
+		FileHeader header;
+		header.ticks_per_second = calibrate();
+		header.start_unix_ns	= std::chrono::duration_cast<std::chrono::nanoseconds>(
+									  std::chrono::system_clock::now().time_since_epoch())
+									  .count();
+		header.start_ticks = ticks();
+		std::fwrite(&header, sizeof(header), 1, file_);
+
+		running_.store(true, std::memory_order_release);
+		drainer_ = std::thread([this] { run(); });
+		return true;
+	}
+
+	// Drains what every thread has logged so far, then closes the file
+	void stop()
+	{
+		std::lock_guard<std::mutex> lock(control_);
+		if (!running_.exchange(false, std::memory_order_acq_rel))
+			return;
+		drainer_.join();
+		drain_all();
+		std::fclose(file_);
+		file_ = nullptr;
+	}
+
+	bool running() const { return running_.load(std::memory_order_acquire); }
+
+	// Records lost to full rings, over every thread still logging
+	uint64_t dropped()
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		uint64_t					total = 0;
+		for (const auto& ring : rings_)
+			total += ring->dropped();
+		return total;
+	}
+
+	std::shared_ptr<Ring> add_ring()
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		rings_.push_back(std::make_shared<Ring>(options_.ring_bytes, next_thread_++));
+		return rings_.back();
+	}
+
+private:
+	static uint64_t calibrate()
+	{
+#if CT_STR_X86_DISPATCH
+		using clock				= std::chrono::steady_clock;
+		const auto	   start	= clock::now();
+		const uint64_t t0		= ticks();
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		const uint64_t t1		= ticks();
+		const double   elapsed = std::chrono::duration<double>(clock::now() - start).count();
+		return static_cast<uint64_t>(static_cast<double>(t1 - t0) / elapsed);
+#else
+		return 1'000'000'000;
+#endif
+	}
+
+	void run()
+	{
+		while (running_.load(std::memory_order_acquire))
+		{
+			if (drain_all() == 0)
+				std::this_thread::sleep_for(options_.poll);
+		}
+	}
+
+	void write_chunk(ChunkKind kind, uint32_t thread, const void* data, std::size_t size)
+	{
+		const ChunkHeader header{kind, thread, size};
+		std::fwrite(&header, sizeof(header), 1, file_);
+		std::fwrite(data, 1, size, file_);
+	}
+
+	// Messages registered since the last call; the list only grows at the front
+	void write_new_messages()
+	{
+		const MessageNode* head = message_list.load(std::memory_order_acquire);
+		if (head == written_through_)
+			return;
+		std::string chunk;
+		for (const MessageNode* node = head; node != written_through_; node = node->next)
+		{
+			const uint32_t fields[3] = {node->id, static_cast<uint32_t>(node->text.size()),
+										static_cast<uint32_t>(node->layout.size())};
+			chunk.append(reinterpret_cast<const char*>(fields), sizeof(fields));
+			chunk.append(node->text);
+			chunk.append(node->layout);
+		}
+		written_through_ = head;
+		write_chunk(ChunkKind::messages, 0, chunk.data(), chunk.size());
+	}
+
+	// Called only by the drain thread, or by stop() once it has finished. Works on a copy of the ring list, so a
+	// thread logging for the first time never waits behind the file writes.
+	std::size_t drain_all()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			draining_.assign(rings_.begin(), rings_.end());
+		}
+		write_new_messages();
+		std::size_t total	 = 0;
+		bool		finished = false;
+		for (auto& ring : draining_)
+		{
+			const bool closed = ring->closed();
+			total += ring->drain([&](const std::byte* data, std::size_t size)
+								 { write_chunk(ChunkKind::records, ring->thread_index(), data, size); });
+			if (const uint64_t drops = ring->take_new_drops(); drops != 0)
+				write_chunk(ChunkKind::dropped, ring->thread_index(), &drops, sizeof(drops));
+			// Keep only the rings whose thread had exited before this pass, and which are now drained
+			if (closed && ring->empty())
+				finished = true;
+			else
+				ring.reset();
+		}
+		if (finished)
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			std::erase_if(rings_, [this](const std::shared_ptr<Ring>& ring)
+						  { return std::find(draining_.begin(), draining_.end(), ring) != draining_.end(); });
+		}
+		draining_.clear();
+		if (total != 0)
+			std::fflush(file_);
+		return total;
+	}
+
+	std::mutex						   control_;  // serializes start() and stop()
+	std::mutex						   mutex_;	  // guards rings_, next_thread_ and options_
+	std::vector<std::shared_ptr<Ring>> rings_;
+	uint32_t						   next_thread_ = 0;
+	LoggerOptions					   options_;
+	std::vector<std::shared_ptr<Ring>> draining_;
+	std::FILE*						   file_			= nullptr;
+	const MessageNode*				   written_through_ = nullptr;
+	std::atomic<bool>				   running_{false};
+	std::thread						   drainer_;
+};
+
+// The calling thread's ring; set on its first call and cleared when it exits
+inline constinit thread_local Ring* current_ring = nullptr;
+
+// Set once the thread's RingOwner has been destroyed. A later call, say from another thread_local's destructor,
+// must not attach a ring that nothing would ever close.
+inline constinit thread_local bool ring_released = false;
+
+// Hands the ring back when its thread exits, so the logger can free it once drained
+struct RingOwner
+{
+	std::shared_ptr<Ring> ring;
+
+	~RingOwner()
+	{
+		if (ring)
+			ring->close();
+		current_ring  = nullptr;
+		ring_released = true;
+	}
+};
+
+// The calling thread's new ring, or nullptr if the thread is exiting and has already handed its ring back
+inline Ring* attach_ring()
+{
+	if (ring_released)
+		return nullptr;
+	thread_local RingOwner owner;
+	owner.ring	 = Logger::instance().add_ring();
+	current_ring = owner.ring.get();
+	return current_ring;
+}
+
+// Logs one message: the arguments are checked against Fmt as ct_str::format would check them, then copied into
+// the calling thread's ring with the message ID and a timestamp.
+//
+//	ct_str::binlog::Logger::instance().start("app.ctlog");
+//	ct_str::binlog::log<"[INFO] request {} took {} us">(id, micros);
+template <FixedString Fmt, typename... Args>
+inline void log(const Args&... args)
+{
+	format<Fmt>::template check<Args...>();
+	static_assert(((arg_code<Args>() != '?') && ...),
+				  "log: arguments must be bool, char, 16-, 32- or 64-bit integers, float, double or strings");
+	using Def = Message<Fmt, std::decay_t<Args>...>;
+	(void)&Def::node;
+
+	const std::size_t payload = (std::size_t{0} + ... + arg_size(args));
+	const std::size_t bytes	  = record_bytes(payload);
+	Ring*			  ring	  = current_ring;
+	if (ring == nullptr && (ring = attach_ring()) == nullptr)
+		return;
+	std::byte* out = ring->reserve(bytes);
+	if (out == nullptr)
+	{
+		ring->drop();
+		return;
+	}
+	const RecordHeader header{Def::id, static_cast<uint32_t>(payload), ticks()};
+	copy_bytes(out, &header, sizeof(header));
+	out += sizeof(header);
+	((out = encode_arg(out, args)), ...);
+	ring->commit(bytes);
+}
+
+// === READING A LOG ===
+
+struct MessageDefinition
+{
+	std::string text;
+	std::string layout;
+};
+
+struct LogRecord
+{
+	uint32_t		 thread;
+	uint64_t		 time;	// ticks
+	uint32_t		 id;
+	std::string_view args;
+};
+
+// Writes one argument decoded from args for a replacement field with the given spec ('\0' for "{}"), and advances
+// args past it. False if args is too short.
+inline bool render_arg(std::string& out, char code, char spec, std::string_view& args)
+{
+	const std::size_t size = arg_code_size(code);
+	if (args.size() < size)
+		return false;
+	auto read = [&](auto value)
+	{
+		copy_bytes(&value, args.data(), sizeof(value));
+		args.remove_prefix(sizeof(value));
+		return value;
+	};
+	char buf[64];
+	auto integer = [&](auto value)
+	{
+		char* end = spec == 'x' ? rt::to_chars<16>(buf, value) : rt::to_chars(buf, value);
+		out.append(buf, end);
+	};
+	switch (code)
+	{
+	case 'b':
+		out += read(uint8_t{}) != 0 ? "true" : "false";
+		return true;
+	case 'c':
+		out += read(char{});
+		return true;
+	case 's':
+		integer(read(int16_t{}));
+		return true;
+	case 'S':
+		integer(read(uint16_t{}));
+		return true;
+	case 'i':
+		integer(read(int32_t{}));
+		return true;
+	case 'I':
+		integer(read(uint32_t{}));
+		return true;
+	case 'l':
+		integer(read(int64_t{}));
+		return true;
+	case 'L':
+		integer(read(uint64_t{}));
+		return true;
+	case 'f':
+		out.append(buf, rt::to_chars(buf, read(float{})));
+		return true;
+	case 'd':
+		out.append(buf, rt::to_chars(buf, read(double{})));
+		return true;
+	case 'z':
+	{
+		const uint32_t len = read(uint32_t{});
+		if (args.size() < len)
+			return false;
+		out += args.substr(0, len);
+		args.remove_prefix(len);
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+// The text ct_str::format<text> would have written for these arguments. Appends "<bad record>" if the arguments
+// do not match the layout.
+inline void render(std::string& out, const MessageDefinition& message, std::string_view args)
+{
+	const std::string_view text = message.text;
+	std::size_t			   arg	= 0;
+	bool				   ok	= true;
+	for (std::size_t i = 0; ok && i < text.size(); ++i)
+	{
+		const char c = text[i];
+		if ((c == '{' || c == '}') && i + 1 < text.size() && text[i + 1] == c)
+		{
+			out += c;
+			++i;
+		}
+		else if (c == '{')
+		{
+			const std::size_t close = text.find('}', i);
+			ok = close != std::string_view::npos && arg < message.layout.size() &&
+				 render_arg(out, message.layout[arg++], close - i == 3 ? text[i + 2] : '\0', args);
+			i  = close;
+		}
+		else
+			out += c;
+	}
+	if (!ok || arg != message.layout.size() || !args.empty())
+		out += "<bad record>";
+}
+
+// A whole log file read into memory, its records in timestamp order
+class LogReader
+{
+public:
+	LogReader()							   = default;
+	LogReader(const LogReader&)			   = delete;  // records point into the data
+	LogReader& operator=(const LogReader&) = delete;
+
+	// False, with error() set, if data is not a complete log written by this version on a machine of the same
+	// byte order
+	bool parse(std::string data)
+	{
+		data_ = std::move(data);
+		messages_.clear();
+		collisions_.clear();
+		records_.clear();
+		dropped_ = 0;
+		if (data_.size() < sizeof(FileHeader))
+			return fail("too short for a log header");
+		copy_bytes(&header_, data_.data(), sizeof(header_));
+		const FileHeader expected;
+		if (std::string_view(header_.magic, 8) != std::string_view(expected.magic, 8))
+			return fail("not a ct_str binary log");
+		if (header_.version != expected.version || header_.byte_order != expected.byte_order)
+			return fail("written by another version or on a machine of another byte order");
+
+		for (std::size_t pos = sizeof(FileHeader); pos < data_.size();)
+		{
+			ChunkHeader chunk;
+			if (data_.size() - pos < sizeof(chunk))
+				return fail("truncated chunk header");
+			copy_bytes(&chunk, data_.data() + pos, sizeof(chunk));
+			pos += sizeof(chunk);
+			if (data_.size() - pos < chunk.size)
+				return fail("truncated chunk");
+			const std::string_view body(data_.data() + pos, chunk.size);
+			pos += chunk.size;
+			if (chunk.kind == ChunkKind::messages && !read_messages(body))
+				return fail("bad message table");
+			if (chunk.kind == ChunkKind::records && !read_records(chunk.thread, body))
+				return fail("bad record");
+			if (chunk.kind == ChunkKind::dropped && body.size() == sizeof(uint64_t))
+			{
+				uint64_t count;
+				copy_bytes(&count, body.data(), sizeof(count));
+				dropped_ += count;
+			}
+		}
+		std::stable_sort(records_.begin(), records_.end(),
+						 [](const LogRecord& a, const LogRecord& b) { return a.time < b.time; });
+		return true;
+	}
+
+	const FileHeader&			  header() const { return header_; }
+	const std::vector<LogRecord>& records() const { return records_; }
+	const auto&					  messages() const { return messages_; }
+	const std::vector<uint32_t>&  collisions() const { return collisions_; }
+	uint64_t					  dropped() const { return dropped_; }
+	const std::string&			  error() const { return error_; }
+
+	// Nullptr if id is not in the file's message table, or if it is one of collisions()
+	const MessageDefinition* message(uint32_t id) const
+	{
+		const auto it = messages_.find(id);
+		if (it == messages_.end() || ambiguous(id))
+			return nullptr;
+		return &it->second;
+	}
+
+	bool ambiguous(uint32_t id) const { return std::find(collisions_.begin(), collisions_.end(), id) != collisions_.end(); }
+
+	// Seconds from Logger::start() to the record
+	double seconds(const LogRecord& record) const
+	{
+		const double ticks = static_cast<double>(static_cast<int64_t>(record.time - header_.start_ticks));
+		return ticks / static_cast<double>(header_.ticks_per_second);
+	}
+
+	// The record's text; "<unknown message 0x...>" if its ID is not in the file's message table, or
+	// "<ambiguous message 0x...>" if two messages in the table share it
+	std::string text(const LogRecord& record) const
+	{
+		std::string out;
+		if (const MessageDefinition* def = message(record.id))
+			render(out, *def, record.args);
+		else
+		{
+			char buf[8];
+			out = ambiguous(record.id) ? "<ambiguous message 0x" : "<unknown message 0x";
+			out.append(buf, rt::to_chars<16>(buf, record.id, 8));
+			out += '>';
+		}
+		return out;
+	}
+
+private:
+	bool fail(std::string message)
+	{
+		error_ = std::move(message);
+		return false;
+	}
+
+	bool read_messages(std::string_view body)
+	{
+		while (!body.empty())
+		{
+			uint32_t fields[3];
+			if (body.size() < sizeof(fields))
+				return false;
+			copy_bytes(fields, body.data(), sizeof(fields));
+			body.remove_prefix(sizeof(fields));
+			if (body.size() < std::size_t{fields[1]} + fields[2])
+				return false;
+			const std::string_view text	  = body.substr(0, fields[1]);
+			const std::string_view layout = body.substr(fields[1], fields[2]);
+			const auto [it, added] =
+				messages_.try_emplace(fields[0], MessageDefinition{std::string(text), std::string(layout)});
+			if (!added && (it->second.text != text || it->second.layout != layout) && !ambiguous(fields[0]))
+				collisions_.push_back(fields[0]);
+			body.remove_prefix(std::size_t{fields[1]} + fields[2]);
+		}
+		return true;
+	}
+
+	bool read_records(uint32_t thread, std::string_view body)
+	{
+		while (!body.empty())
+		{
+			RecordHeader header;
+			if (body.size() < sizeof(header))
+				return false;
+			copy_bytes(&header, body.data(), sizeof(header));
+			const std::size_t bytes = record_bytes(header.size);
+			if (body.size() < bytes)
+				return false;
+			records_.push_back({thread, header.time, header.id, body.substr(sizeof(header), header.size)});
+			body.remove_prefix(bytes);
+		}
+		return true;
+	}
+
+	std::string									   data_;
+	FileHeader									   header_;
+	std::unordered_map<uint32_t, MessageDefinition> messages_;
+	std::vector<uint32_t>						   collisions_;
+	std::vector<LogRecord>						   records_;
+	uint64_t									   dropped_ = 0;
+	std::string									   error_;
+};
+
+}  // namespace ct_str::binlog
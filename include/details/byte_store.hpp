@@ -5,6 +5,8 @@ BSD-3-Clause License - See ct_str.hpp for full license text.
 
 #pragma once
 
+#include "fixed_string.hpp"
+#include "string_store.hpp"
 #include <cstddef>
 #include <cstdint>
 
@@ -42,48 +44,38 @@ template <std::size_t N>
 FixedBytes(const uint8_t (&)[N]) -> FixedBytes<N>;
 
 // === THE CANONICAL BYTE PROVIDER ===
+
+template <FixedBytes Bytes>
+consteval FixedString<char, sizeof(Bytes.data) * 2 + 1> byte_store_hex()
+{
+	constexpr char hex_chars[] = "0123456789abcdef";
+	char		   text[sizeof(Bytes.data) * 2 + 1]{};
+	for (std::size_t i = 0; i < sizeof(Bytes.data); ++i)
+	{
+		text[i * 2]		= hex_chars[(Bytes.data[i] >> 4) & 0x0F];
+		text[i * 2 + 1] = hex_chars[Bytes.data[i] & 0x0F];
+	}
+	return text;
+}
+
+// Storage follows StringStore, including CT_STR_SINGLE_COPY_STORAGE for fwd; hex() returns the StringStore of
+// the hex text, so each distinct digest's hex string is emitted once.
 template <FixedBytes Bytes>
 struct ByteStore
 {
 	static constexpr std::size_t N = sizeof(Bytes.data);
 
-	static constexpr struct Storage
-	{
-		uint8_t data[N];
-		consteval Storage()
-			: data{}
-		{
-			for (std::size_t i = 0; i < N; ++i)
-				data[i] = Bytes.data[i];
-		}
-	} storage{};
-
-	static constexpr auto			fwd	  = Bytes;
-	static constexpr const uint8_t* value = storage.data;
+#if CT_STR_SINGLE_COPY_STORAGE
+	static constexpr const auto& fwd = Bytes;
+#else
+	static constexpr auto fwd = Bytes;
+#endif
+	static constexpr const auto&	storage = Bytes;
+	static constexpr const uint8_t* value	= Bytes.data;
 	static constexpr std::size_t	size() { return N; }
 
-	// Convert to hex string at compile time
-	static constexpr auto hex()
-	{
-		struct HexStorage
-		{
-			char data[N * 2 + 1]{};
-			consteval HexStorage()
-			{
-				constexpr char hex_chars[] = "0123456789abcdef";
-				for (std::size_t i = 0; i < N; ++i)
-				{
-					data[i * 2]		= hex_chars[(Bytes.data[i] >> 4) & 0x0F];
-					data[i * 2 + 1] = hex_chars[Bytes.data[i] & 0x0F];
-				}
-				data[N * 2] = '\0';
-			}
-			static constexpr std::size_t size() { return N * 2; }
-			static constexpr std::size_t length() { return N * 2; }
-		};
-		static constexpr HexStorage hex_storage{};
-		return hex_storage.data;
-	}
+	// Hex string, computed at compile time
+	static constexpr const char* hex() { return StringStore<byte_store_hex<Bytes>()>::value; }
 };
 
 }  // namespace ct_str
\ No newline at end of file
@@ -0,0 +1,116 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#pragma once
+
+// x86 runtime dispatch is available when the compiler can build per-function target code and query CPUID
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define CT_STR_X86_DISPATCH 1
+#define CT_STR_TARGET(features) __attribute__((target(features)))
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(_M_X64)
+#define CT_STR_X86_DISPATCH 1
+#define CT_STR_TARGET(features)
+#include <immintrin.h>
+#include <intrin.h>
+#else
+#define CT_STR_X86_DISPATCH 0
+#define CT_STR_TARGET(features)
+#endif
+
+#include <cstdint>
+
+namespace ct_str::rt
+{
+
+// Instruction set extensions relevant to the runtime kernels. A feature is only reported when both the CPU
+// and the operating system (for the wider register files) support it.
+struct CpuFeatures
+{
+	bool sse41	  = false;
+	bool pclmul	  = false;
+	bool avx2	  = false;
+	bool avx512f  = false;
+	bool avx512vl = false;
+	bool avx512bw = false;
+	bool sha	  = false;
+};
+
+#if CT_STR_X86_DISPATCH
+
+inline void cpuid(uint32_t leaf, uint32_t subleaf, uint32_t (&regs)[4])
+{
+#if defined(_M_X64) && !defined(__GNUC__)
+	int out[4];
+	__cpuidex(out, static_cast<int>(leaf), static_cast<int>(subleaf));
+	for (int i = 0; i < 4; ++i)
+		regs[i] = static_cast<uint32_t>(out[i]);
+#else
+	__cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+inline uint64_t xgetbv0()
+{
+#if defined(_M_X64) && !defined(__GNUC__)
+	return _xgetbv(0);
+#else
+	uint32_t eax, edx;
+	__asm__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+	return (static_cast<uint64_t>(edx) << 32) | eax;
+#endif
+}
+
+inline CpuFeatures detect_cpu_features()
+{
+	CpuFeatures f;
+	uint32_t	regs[4]{};
+
+	cpuid(0, 0, regs);
+	const uint32_t max_leaf = regs[0];
+
+	cpuid(1, 0, regs);
+	const uint32_t ecx1 = regs[2];
+	f.sse41				= (ecx1 >> 19) & 1;
+	f.pclmul			= (ecx1 >> 1) & 1;
+
+	// XMM/YMM state (XCR0 bits 1-2) and opmask/ZMM state (bits 5-7) must be enabled by the OS
+	const bool osxsave = (ecx1 >> 27) & 1;
+	const bool avx	   = (ecx1 >> 28) & 1;
+	uint64_t   xcr0	   = osxsave ? xgetbv0() : 0;
+	const bool os_ymm  = (xcr0 & 0x06) == 0x06;
+	const bool os_zmm  = (xcr0 & 0xE6) == 0xE6;
+
+	if (max_leaf >= 7)
+	{
+		cpuid(7, 0, regs);
+		const uint32_t ebx7 = regs[1];
+		f.avx2				= avx && os_ymm && ((ebx7 >> 5) & 1);
+		f.avx512f			= os_zmm && ((ebx7 >> 16) & 1);
+		f.avx512bw			= f.avx512f && ((ebx7 >> 30) & 1);
+		f.avx512vl			= f.avx512f && ((ebx7 >> 31) & 1);
+		f.sha				= (ebx7 >> 29) & 1;
+	}
+	return f;
+}
+
+#else
+
+inline CpuFeatures detect_cpu_features()
+{
+	return {};
+}
+
+#endif
+
+// Detected once, on first use
+inline const CpuFeatures& cpu_features()
+{
+	static const CpuFeatures features = detect_cpu_features();
+	return features;
+}
+
+}  // namespace ct_str::rt
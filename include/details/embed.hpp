@@ -0,0 +1,55 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#pragma once
+
+#include "byte_store.hpp"
+#include "fixed_string.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace ct_str
+{
+
+// === EMBEDDED ASSETS ===
+
+// Joins the chunks that headers generated by ct_str_embed (cmake/CtStrEmbed.cmake) split each asset into.
+// Each chunk is copied by its own loop, so no single loop runs longer than the chunk size (GCC stops constant
+// evaluation of a loop after 262144 iterations), and each chunk's literal stays within the compilers' limits
+// on the length of a string literal.
+template <std::size_t... Sizes>
+consteval auto embed_bytes(const uint8_t (&... chunks)[Sizes])
+{
+	constexpr std::size_t sizes[] = {Sizes...};
+	const uint8_t*		  parts[] = {chunks...};
+
+	FixedBytes<(Sizes + ... + 0)> result{};
+	uint8_t*					  out = result.data;
+	for (std::size_t c = 0; c < sizeof...(Sizes); ++c)
+	{
+		for (const uint8_t *p = parts[c], *end = p + sizes[c]; p != end; ++p)
+			*out++ = *p;
+	}
+	return result;
+}
+
+// Text chunks are string literals; their terminators are dropped
+template <typename CharT, std::size_t... Sizes>
+consteval auto embed_text(const CharT (&... chunks)[Sizes])
+{
+	constexpr std::size_t sizes[] = {(Sizes - 1)...};
+	const CharT*		  parts[] = {chunks...};
+
+	FixedString<CharT, ((Sizes - 1) + ... + 0) + 1> result{};
+	CharT*											out = result.data;
+	for (std::size_t c = 0; c < sizeof...(Sizes); ++c)
+	{
+		for (const CharT *p = parts[c], *end = p + sizes[c]; p != end; ++p)
+			*out++ = *p;
+	}
+	return result;
+}
+
+}  // namespace ct_str
@@ -0,0 +1,598 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#pragma once
+
+#include "number_fns.hpp"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace ct_str
+{
+
+// === FLOATING-POINT FIELDS ===
+
+// The sign, biased exponent and stored mantissa of an IEEE-754 float or double
+template <typename T>
+struct FloatBits
+{
+	static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>, "FloatBits: float or double required");
+	using Storage = std::conditional_t<std::is_same_v<T, float>, uint32_t, uint64_t>;
+
+	static constexpr unsigned mantissa_bits = std::numeric_limits<T>::digits - 1;
+	static constexpr unsigned exponent_bits = sizeof(T) * 8 - 1 - mantissa_bits;
+	static constexpr int	  bias			= (1 << (exponent_bits - 1)) - 1;
+	static constexpr unsigned max_exponent	= (1u << exponent_bits) - 1;
+
+	bool	 negative;
+	unsigned exponent;
+	uint64_t mantissa;
+
+	constexpr explicit FloatBits(T value)
+	{
+		const auto bits = std::bit_cast<Storage>(value);
+		negative		= (bits >> (sizeof(T) * 8 - 1)) != 0;
+		exponent		= static_cast<unsigned>(bits >> mantissa_bits) & max_exponent;
+		mantissa		= bits & ((Storage{1} << mantissa_bits) - 1);
+	}
+
+	constexpr bool is_finite() const { return exponent != max_exponent; }
+	constexpr bool is_zero() const { return exponent == 0 && mantissa == 0; }
+
+	// The value is significand() * 2^binary_exponent()
+	constexpr uint64_t significand() const
+	{
+		return exponent == 0 ? mantissa : mantissa | (uint64_t{1} << mantissa_bits);
+	}
+	constexpr int binary_exponent() const
+	{
+		return (exponent == 0 ? 1 : static_cast<int>(exponent)) - bias - static_cast<int>(mantissa_bits);
+	}
+};
+
+// === WIDE ARITHMETIC ===
+
+struct UInt128
+{
+	uint64_t lo;
+	uint64_t hi;
+};
+
+constexpr UInt128 umul128(uint64_t a, uint64_t b)
+{
+#if defined(__SIZEOF_INT128__)
+	__extension__ using Wide = unsigned __int128;
+	const Wide product		 = static_cast<Wide>(a) * b;
+	return {static_cast<uint64_t>(product), static_cast<uint64_t>(product >> 64)};
+#else
+	const uint64_t a_lo = a & 0xFFFFFFFF, a_hi = a >> 32;
+	const uint64_t b_lo = b & 0xFFFFFFFF, b_hi = b >> 32;
+	const uint64_t ll = a_lo * b_lo, lh = a_lo * b_hi, hl = a_hi * b_lo, hh = a_hi * b_hi;
+	const uint64_t mid = (ll >> 32) + (lh & 0xFFFFFFFF) + (hl & 0xFFFFFFFF);
+	return {(mid << 32) | (ll & 0xFFFFFFFF), hh + (lh >> 32) + (hl >> 32) + (mid >> 32)};
+#endif
+}
+
+// Unsigned integer of up to Limbs 32-bit limbs, least significant first. Used to build the power-of-five tables
+// and for exact fixed-precision output of values whose bits do not fit in 64.
+template <std::size_t Limbs>
+struct BigUInt
+{
+	uint32_t	limb[Limbs]{};
+	std::size_t size = 0;
+
+	constexpr explicit BigUInt(uint64_t v = 0)
+	{
+		for (; v != 0; v >>= 32)
+			limb[size++] = static_cast<uint32_t>(v);
+	}
+
+	constexpr bool is_zero() const { return size == 0; }
+
+	constexpr unsigned bit_width() const
+	{
+		return size == 0 ? 0 : static_cast<unsigned>((size - 1) * 32 + std::bit_width(limb[size - 1]));
+	}
+
+	constexpr void multiply(uint32_t m)
+	{
+		uint64_t carry = 0;
+		for (std::size_t i = 0; i < size; ++i)
+		{
+			carry += static_cast<uint64_t>(limb[i]) * m;
+			limb[i] = static_cast<uint32_t>(carry);
+			carry >>= 32;
+		}
+		if (carry != 0)
+			limb[size++] = static_cast<uint32_t>(carry);
+	}
+
+	// Divides in place and returns the remainder
+	constexpr uint32_t divide(uint32_t d)
+	{
+		uint64_t rem = 0;
+		for (std::size_t i = size; i-- > 0;)
+		{
+			const uint64_t cur = (rem << 32) | limb[i];
+			limb[i]			   = static_cast<uint32_t>(cur / d);
+			rem				   = cur % d;
+		}
+		while (size > 0 && limb[size - 1] == 0)
+			--size;
+		return static_cast<uint32_t>(rem);
+	}
+
+	constexpr void shift_left(unsigned bits)
+	{
+		const std::size_t words = bits / 32;
+		const unsigned	  rest	= bits % 32;
+		if (size == 0)
+			return;
+		limb[size + words] = 0;
+		for (std::size_t i = size; i-- > 0;)
+		{
+			if (rest != 0)
+				limb[i + words + 1] |= limb[i] >> (32 - rest);
+			limb[i + words] = limb[i] << rest;
+		}
+		for (std::size_t i = 0; i < words; ++i)
+			limb[i] = 0;
+		size += words + 1;
+		while (size > 0 && limb[size - 1] == 0)
+			--size;
+	}
+
+	// The 32 bits starting at bit pos, which may lie below bit 0 (those bits read as zero)
+	constexpr uint32_t bits32(int pos) const
+	{
+		const int	   word = pos >= 0 ? pos / 32 : -((31 - pos) / 32);
+		const unsigned rest = static_cast<unsigned>(pos - word * 32);
+		auto		   at	= [this](int i) { return i >= 0 && static_cast<std::size_t>(i) < size ? limb[i] : 0u; };
+		return rest == 0 ? at(word) : (at(word) >> rest) | (at(word + 1) << (32 - rest));
+	}
+
+	// Clears every bit from pos up
+	constexpr void truncate(unsigned pos)
+	{
+		const std::size_t word = pos / 32;
+		if (word >= size)
+			return;
+		limb[word] &= (uint32_t{1} << (pos % 32)) - 1;
+		size = word + 1;
+		while (size > 0 && limb[size - 1] == 0)
+			--size;
+	}
+
+	// Compares with 2^pos
+	constexpr int compare_power_of_2(unsigned pos) const
+	{
+		const unsigned width = bit_width();
+		if (width != pos + 1)
+			return width < pos + 1 ? -1 : 1;
+		for (std::size_t i = 0; i < pos / 32; ++i)
+		{
+			if (limb[i] != 0)
+				return 1;
+		}
+		return (limb[pos / 32] & ((uint32_t{1} << (pos % 32)) - 1)) != 0 ? 1 : 0;
+	}
+};
+
+// Enough for any double shifted into an integer (1024 bits) or a fraction of 1074 bits times ten
+using FloatBigUInt = BigUInt<36>;
+
+// === POWER-OF-FIVE TABLES ===
+
+// ceil(log2(5^e)) for 0 < e <= 3528, and 1 for e = 0
+constexpr unsigned pow5_bits(unsigned e)
+{
+	return ((e * 1217359u) >> 19) + 1;
+}
+
+// floor(log10(2^e)) and floor(log10(5^e))
+constexpr unsigned log10_pow2(unsigned e)
+{
+	return (e * 78913u) >> 18;
+}
+
+constexpr unsigned log10_pow5(unsigned e)
+{
+	return (e * 732923u) >> 20;
+}
+
+// The 125-bit multipliers of Ryu (Adams, "Ryu: Fast Float-to-String Conversion", PLDI 2018): split[i] holds the
+// top 125 bits of 5^i and inv_split[i] is floor(2^(pow5_bits(i) - 1 + 125) / 5^i) + 1, both as {low, high}.
+// The sizes cover every double exponent, and so every float exponent too.
+struct Pow5Tables
+{
+	static constexpr unsigned bit_count = 125;
+
+	uint64_t split[326][2];
+	uint64_t inv_split[342][2];
+};
+
+consteval Pow5Tables make_pow5_tables()
+{
+	Pow5Tables tables{};
+	auto	   store = [](uint64_t (&entry)[2], const FloatBigUInt& v, int pos)
+	{
+		entry[0] = v.bits32(pos) | (static_cast<uint64_t>(v.bits32(pos + 32)) << 32);
+		entry[1] = v.bits32(pos + 64) | (static_cast<uint64_t>(v.bits32(pos + 96)) << 32);
+	};
+
+	FloatBigUInt pow5(1);
+	for (unsigned i = 0; i < 326; ++i, pow5.multiply(5))
+		store(tables.split[i], pow5, static_cast<int>(pow5.bit_width()) - static_cast<int>(Pow5Tables::bit_count));
+
+	// floor(floor(2^K / 5^(i-1)) / 5) = floor(2^K / 5^i), so dividing one 2^K by five each step gives every
+	// reciprocal, and a shift gives floor(2^j / 5^i) for any j <= K
+	constexpr unsigned K = 33 * 32;
+	FloatBigUInt	   reciprocal{};
+	reciprocal.limb[33] = 1;
+	reciprocal.size		= 34;
+	for (unsigned i = 0; i < 342; ++i, reciprocal.divide(5))
+	{
+		const unsigned j = pow5_bits(i) - 1 + Pow5Tables::bit_count;
+		store(tables.inv_split[i], reciprocal, static_cast<int>(K - j));
+		tables.inv_split[i][1] += ++tables.inv_split[i][0] == 0;
+	}
+	return tables;
+}
+
+// Built once per program and shared by compile-time and runtime formatting. A template so that it is only built
+// in translation units that format floating-point values (about 0.1 s with GCC).
+template <int = 0>
+inline constexpr Pow5Tables pow5_tables = make_pow5_tables();
+
+// === SHORTEST DIGITS ===
+
+// A finite value as digits * 10^exponent
+struct DecimalFloat
+{
+	uint64_t digits;
+	int		 exponent;
+};
+
+// (m * mul) >> j for the 128-bit mul, with 64 <= j < 128
+constexpr uint64_t mul_shift_64(uint64_t m, const uint64_t (&mul)[2], int j)
+{
+	const UInt128  high = umul128(m, mul[1]);
+	const UInt128  low	= umul128(m, mul[0]);
+	const uint64_t sum	= low.hi + high.lo;
+	const uint64_t top	= high.hi + (sum < low.hi);
+	const unsigned dist = static_cast<unsigned>(j - 64);
+	return dist == 0 ? sum : (top << (64 - dist)) | (sum >> dist);
+}
+
+constexpr unsigned pow5_factor(uint64_t v)
+{
+	unsigned count = 0;
+	for (; v % 5 == 0; v /= 5)
+		++count;
+	return count;
+}
+
+// The shortest digits that read back as the value, nearest to it, ties to even: Ryu's d2s core, which also
+// serves floats since their significands and exponents fit within a double's.
+template <typename T>
+constexpr DecimalFloat shortest_decimal(const FloatBits<T>& bits)
+{
+	const int	   e2				= bits.binary_exponent() - 2;
+	const uint64_t m2				= bits.significand();
+	const bool	   accept_bounds	= (m2 & 1) == 0;
+	const uint64_t mv				= 4 * m2;
+	const unsigned mm_shift			= bits.mantissa != 0 || bits.exponent <= 1;
+	constexpr unsigned bit_count	= Pow5Tables::bit_count;
+
+	uint64_t vr, vp, vm;
+	int		 e10;
+	bool	 vm_trailing_zeros = false;
+	bool	 vr_trailing_zeros = false;
+	auto	 scale			   = [&](const uint64_t (&mul)[2], int j)
+	{
+		vr = mul_shift_64(mv, mul, j);
+		vp = mul_shift_64(mv + 2, mul, j);
+		vm = mul_shift_64(mv - 1 - mm_shift, mul, j);
+	};
+	if (e2 >= 0)
+	{
+		const unsigned q = log10_pow2(static_cast<unsigned>(e2)) - (e2 > 3);
+		e10				 = static_cast<int>(q);
+		const int k		 = static_cast<int>(bit_count + pow5_bits(q)) - 1;
+		scale(pow5_tables<>.inv_split[q], -e2 + static_cast<int>(q) + k);
+		if (q <= 21)
+		{
+			if (mv % 5 == 0)
+				vr_trailing_zeros = pow5_factor(mv) >= q;
+			else if (accept_bounds)
+				vm_trailing_zeros = pow5_factor(mv - 1 - mm_shift) >= q;
+			else
+				vp -= pow5_factor(mv + 2) >= q;
+		}
+	}
+	else
+	{
+		const unsigned q = log10_pow5(static_cast<unsigned>(-e2)) - (-e2 > 1);
+		e10				 = static_cast<int>(q) + e2;
+		const int i		 = -e2 - static_cast<int>(q);
+		const int k		 = static_cast<int>(pow5_bits(static_cast<unsigned>(i))) - static_cast<int>(bit_count);
+		scale(pow5_tables<>.split[i], static_cast<int>(q) - k);
+		if (q <= 1)
+		{
+			vr_trailing_zeros = true;
+			if (accept_bounds)
+				vm_trailing_zeros = mm_shift == 1;
+			else
+				--vp;
+		}
+		else if (q < 63)
+			vr_trailing_zeros = (mv & ((uint64_t{1} << q) - 1)) == 0;
+	}
+
+	// Drop digits while the interval still holds a shorter number
+	int		 removed = 0;
+	uint64_t output;
+	if (vm_trailing_zeros || vr_trailing_zeros)
+	{
+		unsigned last_removed = 0;
+		for (; vp / 10 > vm / 10; ++removed)
+		{
+			vm_trailing_zeros &= vm % 10 == 0;
+			vr_trailing_zeros &= last_removed == 0;
+			last_removed = static_cast<unsigned>(vr % 10);
+			vr /= 10;
+			vp /= 10;
+			vm /= 10;
+		}
+		if (vm_trailing_zeros)
+		{
+			for (; vm % 10 == 0; ++removed)
+			{
+				vr_trailing_zeros &= last_removed == 0;
+				last_removed = static_cast<unsigned>(vr % 10);
+				vr /= 10;
+				vp /= 10;
+				vm /= 10;
+			}
+		}
+		if (vr_trailing_zeros && last_removed == 5 && vr % 2 == 0)
+			last_removed = 4;
+		output = vr + ((vr == vm && (!accept_bounds || !vm_trailing_zeros)) || last_removed >= 5);
+	}
+	else
+	{
+		bool round_up = false;
+		if (vp / 100 > vm / 100)
+		{
+			round_up = vr % 100 >= 50;
+			vr /= 100;
+			vp /= 100;
+			vm /= 100;
+			removed += 2;
+		}
+		for (; vp / 10 > vm / 10; ++removed)
+		{
+			round_up = vr % 10 >= 5;
+			vr /= 10;
+			vp /= 10;
+			vm /= 10;
+		}
+		output = vr + (vr == vm || round_up);
+	}
+	return {output, e10 + removed};
+}
+
+// === TEXT OUTPUT ===
+
+// Longest text of write_shortest: sign, every significant digit, point and exponent
+template <typename T>
+inline constexpr std::size_t shortest_max_length =
+	1 + std::numeric_limits<T>::max_digits10 + 1 + 2 + (std::numeric_limits<T>::max_exponent10 >= 100 ? 3 : 2);
+
+// Longest text of write_fixed with the given precision
+template <typename T>
+constexpr std::size_t fixed_max_length(std::size_t precision)
+{
+	return 1 + std::numeric_limits<T>::max_exponent10 + 1 + 1 + precision;
+}
+
+constexpr char* write_special(char* out, const char* text)
+{
+	for (int i = 0; i < 3; ++i)
+		*out++ = text[i];
+	return out;
+}
+
+// Writes m * 2^e in full; it must be an integer
+constexpr char* write_shifted_integer(char* out, uint64_t m, int e)
+{
+	if (e < 0)
+	{
+		m >>= -e;
+		e = 0;
+	}
+	if (e <= 63 - static_cast<int>(std::bit_width(m)))
+		return write_decimal(out, m << e, decimal_length(m << e));
+
+	FloatBigUInt whole(m);
+	whole.shift_left(static_cast<unsigned>(e));
+	uint32_t	chunks[40]{};
+	std::size_t count = 0;
+	while (!whole.is_zero())
+		chunks[count++] = whole.divide(1'000'000'000);
+	out = write_decimal(out, chunks[count - 1], decimal_length(chunks[count - 1]));
+	while (--count > 0)
+		out = write_integer<10>(out, chunks[count - 1], 9);
+	return out;
+}
+
+// Writes value the way std::to_chars(first, last, value) does: the shortest digits that read back as value, in
+// fixed or scientific notation, whichever is shorter, and fixed on a tie. In fixed notation an integer too large
+// for its shortest digits is written in full, as printf would ("1152921504606846976", not "1152921504606847000").
+// "inf" and "nan" carry the sign bit.
+template <typename T>
+constexpr char* write_shortest(char* out, T value)
+{
+	const FloatBits<T> bits(value);
+	if (bits.negative)
+		*out++ = '-';
+	if (!bits.is_finite())
+		return write_special(out, bits.mantissa != 0 ? "nan" : "inf");
+	if (bits.is_zero())
+	{
+		*out = '0';
+		return out + 1;
+	}
+
+	const DecimalFloat d	   = shortest_decimal(bits);
+	const int		   n	   = static_cast<int>(decimal_length(d.digits));
+	const int		   sci_exp = d.exponent + n - 1;
+	const int		   sci_len = n + (n > 1) + 2 + (sci_exp >= 100 || sci_exp <= -100 ? 3 : 2);
+	const int		   fix_len = d.exponent >= 0 ? n + d.exponent : -d.exponent < n ? n + 1 : 2 - d.exponent;
+
+	if (fix_len <= sci_len)
+	{
+		if (d.exponent > 0)
+			return write_shifted_integer(out, bits.significand(), bits.binary_exponent());
+		if (d.exponent == 0)
+			return write_decimal(out, d.digits, static_cast<unsigned>(n));
+		const int point = n + d.exponent;
+		if (point > 0)
+		{
+			// Digits written one place to the right, then the integer part moved back over the gap
+			write_decimal(out + 1, d.digits, static_cast<unsigned>(n));
+			for (int i = 0; i < point; ++i)
+				out[i] = out[i + 1];
+			out[point] = '.';
+			return out + n + 1;
+		}
+		*out++ = '0';
+		*out++ = '.';
+		for (int i = point; i < 0; ++i)
+			*out++ = '0';
+		return write_decimal(out, d.digits, static_cast<unsigned>(n));
+	}
+
+	write_decimal(out + 1, d.digits, static_cast<unsigned>(n));
+	out[0] = out[1];
+	if (n > 1)
+	{
+		out[1] = '.';
+		out += n + 1;
+	}
+	else
+		out += 1;
+	*out++			   = 'e';
+	*out++			   = sci_exp < 0 ? '-' : '+';
+	const unsigned mag = static_cast<unsigned>(sci_exp < 0 ? -sci_exp : sci_exp);
+	if (mag >= 100)
+		*out++ = static_cast<char>('0' + mag / 100);
+	*out++ = digit_pairs.data[mag % 100 * 2];
+	*out++ = digit_pairs.data[mag % 100 * 2 + 1];
+	return out;
+}
+
+// Rounds the digits in [first, last) up by one unit in the last place, skipping the point. Returns true if the
+// carry ran off the front, in which case every digit is now '0'.
+constexpr bool round_digits_up(char* first, char* last)
+{
+	while (last != first)
+	{
+		char& c = *--last;
+		if (c == '.')
+			continue;
+		if (c != '9')
+		{
+			++c;
+			return false;
+		}
+		c = '0';
+	}
+	return true;
+}
+
+// Writes value exactly as printf("%.*f", precision, value) does in the C locale, rounding the exact binary value
+// to nearest with ties to even. out has room for fixed_max_length<T>(precision) characters.
+template <typename T>
+constexpr char* write_fixed(char* out, T value, std::size_t precision)
+{
+	const FloatBits<T> bits(value);
+	if (bits.negative)
+		*out++ = '-';
+	if (!bits.is_finite())
+		return write_special(out, bits.mantissa != 0 ? "nan" : "inf");
+
+	const uint64_t m = bits.significand();
+	const int	   e = bits.binary_exponent();
+	char* const	   first = out;
+
+	// The integer part; a fraction of s bits remains when e < 0
+	if (e >= 0)
+		out = write_shifted_integer(out, m, e);
+	else
+	{
+		const unsigned s = static_cast<unsigned>(-e);
+		const uint64_t whole = s < 64 ? m >> s : 0;
+		out					 = write_decimal(out, whole, decimal_length(whole));
+	}
+	if (precision > 0)
+		*out++ = '.';
+	if (e >= 0)
+	{
+		for (std::size_t i = 0; i < precision; ++i)
+			*out++ = '0';
+		return out;
+	}
+
+	// Fraction digits: multiply the s-bit fraction by ten and take the bits that reach past it. It runs out
+	// after at most s digits; the remainder then decides the rounding.
+	const unsigned s	   = static_cast<unsigned>(-e);
+	int			   compare = 0;	 // remainder against one half
+	if (s <= 60)
+	{
+		const uint64_t mask = (uint64_t{1} << s) - 1;
+		uint64_t	   frac = m & mask;
+		for (std::size_t i = 0; i < precision; ++i)
+		{
+			frac *= 10;
+			*out++ = static_cast<char>('0' + (frac >> s));
+			frac &= mask;
+		}
+		const uint64_t half = uint64_t{1} << (s - 1);
+		compare				= frac < half ? -1 : frac > half ? 1 : 0;
+	}
+	else
+	{
+		FloatBigUInt frac(m);
+		std::size_t	 i = 0;
+		for (; i < precision && !frac.is_zero(); ++i)
+		{
+			frac.multiply(10);
+			*out++ = static_cast<char>('0' + frac.bits32(static_cast<int>(s)));
+			frac.truncate(s);
+		}
+		for (; i < precision; ++i)
+			*out++ = '0';
+		compare = frac.compare_power_of_2(s - 1);
+	}
+
+	const char last_digit = out[-1] == '.' ? out[-2] : out[-1];
+	if (compare > 0 || (compare == 0 && (last_digit - '0') % 2 == 1))
+	{
+		if (round_digits_up(first, out))
+		{
+			for (char* p = out; p != first; --p)
+				p[0] = p[-1];
+			*first = '1';
+			++out;
+		}
+	}
+	return out;
+}
+
+}  // namespace ct_str
@@ -0,0 +1,364 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#pragma once
+
+#include "fixed_string.hpp"
+#include "float_fns.hpp"
+#include "number_fns.hpp"
+#include "string_store.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace ct_str
+{
+
+// === FORMAT STRING PARSING ===
+
+// What a replacement field accepts, and what kind of value an argument is. "{}" is any; "{:d}", "{:x}", "{:s}"
+// and "{:c}" require an integer, an integer (written in hex), a string (or bool) and a char. Floating-point
+// arguments only go in "{}".
+enum class FormatSlot : uint8_t
+{
+	any,
+	integer,
+	hex,
+	string,
+	character,
+	boolean,
+	floating,
+	unsupported
+};
+
+enum class FormatError : uint8_t
+{
+	none,
+	unmatched_open,
+	unmatched_close,
+	bad_spec
+};
+
+// A format string split into literal segments and slots: segment i, the text before slot i (the last one
+// follows the last slot), is text[segment_begin[i], segment_begin[i + 1]). Escaped braces are resolved.
+template <std::size_t N>
+struct FormatParse
+{
+	char		text[N + 1]{};
+	std::size_t text_size = 0;
+	std::size_t segment_begin[N + 2]{};
+	FormatSlot	slot[N + 1]{};
+	std::size_t slot_count = 0;
+	FormatError error	   = FormatError::none;
+};
+
+template <FixedString Fmt>
+consteval auto format_parse_logic()
+{
+	static_assert(std::is_same_v<typename decltype(Fmt)::value_type, char>, "format: format string must be narrow");
+	constexpr std::size_t n = Fmt.size();
+
+	FormatParse<n> parse{};
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		const char c = Fmt[i];
+		if ((c == '{' || c == '}') && i + 1 < n && Fmt[i + 1] == c)
+		{
+			parse.text[parse.text_size++] = c;
+			++i;
+		}
+		else if (c == '}')
+		{
+			parse.error = FormatError::unmatched_close;
+			return parse;
+		}
+		else if (c == '{')
+		{
+			std::size_t close = i + 1;
+			while (close < n && Fmt[close] != '}' && Fmt[close] != '{')
+				++close;
+			if (close == n || Fmt[close] != '}')
+			{
+				parse.error = FormatError::unmatched_open;
+				return parse;
+			}
+
+			FormatSlot slot = FormatSlot::any;
+			if (close - i == 3 && Fmt[i + 1] == ':')
+			{
+				const char spec = Fmt[i + 2];
+				slot			= spec == 'd' ? FormatSlot::integer
+								: spec == 'x' ? FormatSlot::hex
+								: spec == 's' ? FormatSlot::string
+								: spec == 'c' ? FormatSlot::character
+											  : FormatSlot::unsupported;
+			}
+			else if (close - i != 1)
+				slot = FormatSlot::unsupported;
+			if (slot == FormatSlot::unsupported)
+			{
+				parse.error = FormatError::bad_spec;
+				return parse;
+			}
+
+			parse.slot[parse.slot_count++]			= slot;
+			parse.segment_begin[parse.slot_count] = parse.text_size;
+			i									  = close;
+		}
+		else
+			parse.text[parse.text_size++] = c;
+	}
+	parse.segment_begin[parse.slot_count + 1] = parse.text_size;
+	return parse;
+}
+
+// Parsed once per format string
+template <FixedString Fmt>
+inline constexpr auto format_parse = format_parse_logic<Fmt>();
+
+// The literal text of every segment, back to back
+template <FixedString Fmt>
+consteval auto format_text_logic()
+{
+	constexpr const auto& parse = format_parse<Fmt>;
+	return FixedString<char, parse.text_size + 1>(parse.text, parse.text_size);
+}
+
+// === ARGUMENTS ===
+
+template <typename T>
+consteval FormatSlot format_arg_kind()
+{
+	using U = std::remove_cvref_t<T>;
+	if constexpr (std::is_same_v<U, bool>)
+		return FormatSlot::boolean;
+	else if constexpr (std::is_same_v<U, char>)
+		return FormatSlot::character;
+	else if constexpr (std::is_same_v<U, signed char> || std::is_same_v<U, unsigned char> ||
+					   std::is_same_v<U, wchar_t> || std::is_same_v<U, char8_t> || std::is_same_v<U, char16_t> ||
+					   std::is_same_v<U, char32_t>)
+		return FormatSlot::unsupported;
+	else if constexpr (std::is_integral_v<U>)
+		return FormatSlot::integer;
+	else if constexpr (std::is_same_v<U, float> || std::is_same_v<U, double>)
+		return FormatSlot::floating;
+	else if constexpr (std::is_convertible_v<const U&, std::string_view>)
+		return FormatSlot::string;
+	else
+		return FormatSlot::unsupported;
+}
+
+constexpr bool format_slot_accepts(FormatSlot slot, FormatSlot arg)
+{
+	if (arg == FormatSlot::unsupported)
+		return false;
+	return slot == FormatSlot::any || slot == arg || (slot == FormatSlot::string && arg == FormatSlot::boolean) ||
+		   (slot == FormatSlot::hex && arg == FormatSlot::integer);
+}
+
+// Longest text an argument can produce; hex is never longer than decimal
+template <typename T>
+constexpr std::size_t format_arg_bound(const T& arg)
+{
+	constexpr FormatSlot kind = format_arg_kind<T>();
+	if constexpr (kind == FormatSlot::integer)
+		return decimal_max_length<std::remove_cvref_t<T>>;
+	else if constexpr (kind == FormatSlot::floating)
+		return shortest_max_length<std::remove_cvref_t<T>>;
+	else if constexpr (kind == FormatSlot::string)
+		return std::string_view(arg).size();
+	else if constexpr (kind == FormatSlot::character)
+		return 1;
+	else
+		return 5;
+}
+
+// memcpy through char_traits, which avoids <cstring> and the C library names it declares (such as basename)
+inline void format_copy(char* out, const char* src, std::size_t len)
+{
+	std::char_traits<char>::copy(out, src, len);
+}
+
+// Writes an argument with no bounds check; out has room for format_arg_bound(arg) characters
+template <FormatSlot Slot, typename T>
+inline char* format_write_arg(char* out, const T& arg)
+{
+	constexpr FormatSlot kind = format_arg_kind<T>();
+	if constexpr (Slot == FormatSlot::hex)
+		return write_integer<16>(out, arg);
+	else if constexpr (kind == FormatSlot::integer)
+		return write_decimal(out, arg);
+	else if constexpr (kind == FormatSlot::floating)
+		return write_shortest(out, arg);
+	else if constexpr (kind == FormatSlot::string)
+	{
+		const std::string_view str(arg);
+		format_copy(out, str.data(), str.size());
+		return out + str.size();
+	}
+	else if constexpr (kind == FormatSlot::character)
+	{
+		*out = arg;
+		return out + 1;
+	}
+	else
+	{
+		format_copy(out, arg ? "true" : "false", arg ? 4 : 5);
+		return out + (arg ? 4 : 5);
+	}
+}
+
+// Bounds-checked output for buffers that may be too small: keeps writing what fits and counts the rest
+struct FormatSink
+{
+	char*		out;
+	std::size_t room;
+	std::size_t total = 0;
+
+	void put(const char* data, std::size_t len)
+	{
+		const std::size_t n = len < room ? len : room;
+		if (n > 0)
+		{
+			format_copy(out, data, n);
+			out += n;
+			room -= n;
+		}
+		total += len;
+	}
+
+	template <FormatSlot Slot, typename T>
+	void put_arg(const T& arg)
+	{
+		if constexpr (format_arg_kind<T>() == FormatSlot::string)
+		{
+			const std::string_view str(arg);
+			put(str.data(), str.size());
+		}
+		else
+		{
+			char		tmp[shortest_max_length<double> + 1];
+			const char* end = format_write_arg<Slot>(tmp, arg);
+			put(tmp, static_cast<std::size_t>(end - tmp));
+		}
+	}
+};
+
+// === FORMAT ===
+
+// A format string parsed at compile time into literal segments and typed slots. write() checks the number and
+// types of its arguments when it is compiled, then copies each literal segment with a fixed-size copy and
+// writes integers two digits at a time and floating-point values in their shortest round-trip form (as
+// std::to_chars does), into the caller's buffer and without allocating:
+//
+//	using Took = ct_str::format<"{}: took {} us">;
+//	char buf[128];
+//	std::string_view line = Took::format_to(buf, name, micros);	// "parse: took 42 us"
+//
+// Replacement fields are "{}", "{:d}" (integers), "{:x}" (integers in lowercase hex), "{:s}" (strings and bools)
+// and "{:c}" (char); "{{" and "}}" are literal braces. Strings are anything convertible to std::string_view;
+// float and double go in "{}".
+template <FixedString Fmt>
+struct format
+{
+	static constexpr const auto& parsed = format_parse<Fmt>;
+	static_assert(parsed.error != FormatError::unmatched_open,
+				  "format: '{' without a matching '}' (write '{{' for a literal brace)");
+	static_assert(parsed.error != FormatError::unmatched_close,
+				  "format: '}' without a matching '{' (write '}}' for a literal brace)");
+	static_assert(parsed.error != FormatError::bad_spec,
+				  "format: replacement fields must be {}, {:d}, {:x}, {:s} or {:c}");
+
+	using literals = StringStore<format_text_logic<Fmt>()>;
+
+	static constexpr std::size_t slots() { return parsed.slot_count; }
+
+	// Length of the literal text alone
+	static constexpr std::size_t literal_size() { return parsed.text_size; }
+
+	// Writes the formatted text to buf, stopping at capacity characters, and returns the length of the whole
+	// text, which is larger than capacity if it was cut short. No terminator is written.
+	template <typename... Args>
+	static std::size_t write(char* buf, std::size_t capacity, const Args&... args)
+	{
+		check<Args...>();
+		if (capacity >= (literal_size() + ... + format_arg_bound(args)))
+			return static_cast<std::size_t>(write_all(buf, std::index_sequence_for<Args...>{}, args...) - buf);
+		FormatSink sink{buf, capacity};
+		write_sink(sink, std::index_sequence_for<Args...>{}, args...);
+		return sink.total;
+	}
+
+	// Writes into an array and returns the part that fit
+	template <std::size_t Capacity, typename... Args>
+	static std::string_view format_to(char (&buf)[Capacity], const Args&... args)
+	{
+		const std::size_t len = write(buf, Capacity, args...);
+		return std::string_view(buf, len < Capacity ? len : Capacity);
+	}
+
+	// Exact length of the formatted text
+	template <typename... Args>
+	static std::size_t size(const Args&... args)
+	{
+		check<Args...>();
+		FormatSink sink{nullptr, 0};
+		write_sink(sink, std::index_sequence_for<Args...>{}, args...);
+		return sink.total;
+	}
+
+	// Fails to compile unless Args match the replacement fields; write() and size() call it, and so can code that
+	// stores arguments to be formatted later
+	template <typename... Args>
+	static constexpr void check()
+	{
+		static_assert(sizeof...(Args) == slots(), "format: argument count does not match the format string");
+		constexpr bool accepted = []
+		{
+			constexpr FormatSlot kinds[] = {format_arg_kind<Args>()..., FormatSlot::any};
+			for (std::size_t i = 0; i < sizeof...(Args); ++i)
+			{
+				if (!format_slot_accepts(parsed.slot[i], kinds[i]))
+					return false;
+			}
+			return true;
+		}();
+		static_assert(accepted, "format: an argument's type does not match its replacement field");
+	}
+
+private:
+	template <std::size_t I>
+	static char* write_segment(char* out)
+	{
+		constexpr std::size_t begin = parsed.segment_begin[I];
+		constexpr std::size_t len	= parsed.segment_begin[I + 1] - begin;
+		if constexpr (len > 0)
+			format_copy(out, literals::value + begin, len);
+		return out + len;
+	}
+
+	template <std::size_t... I, typename... Args>
+	static char* write_all(char* out, std::index_sequence<I...>, const Args&... args)
+	{
+		((out = write_segment<I>(out), out = format_write_arg<parsed.slot[I]>(out, args)), ...);
+		return write_segment<sizeof...(I)>(out);
+	}
+
+	template <std::size_t... I, typename... Args>
+	static void write_sink(FormatSink& sink, std::index_sequence<I...>, const Args&... args)
+	{
+		auto segment = [&sink](std::size_t i)
+		{
+			const std::size_t begin = parsed.segment_begin[i];
+			sink.put(literals::value + begin, parsed.segment_begin[i + 1] - begin);
+		};
+		((segment(I), sink.template put_arg<parsed.slot[I]>(args)), ...);
+		segment(sizeof...(I));
+	}
+};
+
+}  // namespace ct_str
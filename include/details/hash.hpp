@@ -13,17 +13,25 @@ BSD-3-Clause License - See ct_str.hpp for full license text.
 namespace ct_str
 {
 
-// === HASH COMPUTATION HELPERS ===
+// === CRC-32 TABLES ===
 
-consteval uint32_t crc32_compute(const auto* data, std::size_t len)
+// Number of slices in the shared CRC-32 table set. Compile-time evaluation slices by 8; the runtime engine
+// (rt_crc32.hpp) reads the same tables 16 slices at a time.
+inline constexpr std::size_t crc32_slices = 16;
+
+// Lookup tables for slicing-by-N CRC-32. Slice 0 is the classic byte-at-a-time table; slice k advances a byte
+// through k further zero bytes, so several input bytes can be folded into the CRC per step.
+struct Crc32Tables
 {
-	static_assert(sizeof(data[0]) == 1, "crc32_compute: data type must be byte-sized");
+	uint32_t table[crc32_slices][256];
+};
 
+consteval Crc32Tables make_crc32_tables()
+{
 	// CRC-32 polynomial (IEEE 802.3)
 	constexpr uint32_t polynomial = 0xEDB88320;
 
-	// Build CRC table
-	uint32_t table[256]{};
+	Crc32Tables tables{};
 	for (uint32_t i = 0; i < 256; ++i)
 	{
 		uint32_t crc = i;
@@ -31,245 +39,360 @@ consteval uint32_t crc32_compute(const auto* data, std::size_t len)
 		{
 			crc = (crc & 1) ? ((crc >> 1) ^ polynomial) : (crc >> 1);
 		}
-		table[i] = crc;
+		tables.table[0][i] = crc;
+	}
+	for (std::size_t k = 1; k < crc32_slices; ++k)
+	{
+		for (uint32_t i = 0; i < 256; ++i)
+		{
+			uint32_t prev	   = tables.table[k - 1][i];
+			tables.table[k][i] = (prev >> 8) ^ tables.table[0][prev & 0xFF];
+		}
+	}
+	return tables;
+}
+
+// Built once per program and shared by every crc32<Str> evaluation
+inline constexpr Crc32Tables crc32_tables = make_crc32_tables();
+
+// === HASH COMPUTATION HELPERS ===
+
+// Continue a CRC-32 over more data. Start from 0; the result of one call can be passed to the next.
+constexpr uint32_t crc32_update(uint32_t crc, const auto* data, std::size_t len)
+{
+	static_assert(sizeof(data[0]) == 1, "crc32_update: data type must be byte-sized");
+
+	const auto& t	= crc32_tables.table;
+	std::size_t pos = 0;
+	crc				= ~crc;
+
+	auto byte_at = [&](std::size_t i) { return static_cast<uint32_t>(static_cast<uint8_t>(data[i])); };
+	auto load32	 = [&](std::size_t i)
+	{ return byte_at(i) | (byte_at(i + 1) << 8) | (byte_at(i + 2) << 16) | (byte_at(i + 3) << 24); };
+
+	// Slicing-by-8
+	for (; len - pos >= 8; pos += 8)
+	{
+		uint32_t one = crc ^ load32(pos);
+		uint32_t two = load32(pos + 4);
+		crc = t[7][one & 0xFF] ^ t[6][(one >> 8) & 0xFF] ^ t[5][(one >> 16) & 0xFF] ^ t[4][one >> 24] ^
+			  t[3][two & 0xFF] ^ t[2][(two >> 8) & 0xFF] ^ t[1][(two >> 16) & 0xFF] ^ t[0][two >> 24];
 	}
 
-	// Compute CRC
-	uint32_t crc = 0xFFFFFFFF;
-	for (std::size_t i = 0; i < len; ++i)
+	// Slicing-by-4
+	if (len - pos >= 4)
 	{
-		uint8_t byte = static_cast<uint8_t>(data[i]);
-		crc			 = table[(crc ^ byte) & 0xFF] ^ (crc >> 8);
+		uint32_t one = crc ^ load32(pos);
+		crc			 = t[3][one & 0xFF] ^ t[2][(one >> 8) & 0xFF] ^ t[1][(one >> 16) & 0xFF] ^ t[0][one >> 24];
+		pos += 4;
 	}
-	return crc ^ 0xFFFFFFFF;
+
+	// Remaining bytes
+	for (; pos < len; ++pos)
+		crc = t[0][(crc ^ byte_at(pos)) & 0xFF] ^ (crc >> 8);
+
+	return ~crc;
 }
 
-consteval FixedBytes<32> sha256_compute(const auto* data, std::size_t len)
+consteval uint32_t crc32_compute(const auto* data, std::size_t len)
 {
-	// SHA-256 constants
-	constexpr uint32_t K[64] = {
-		0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
-		0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
-		0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
-		0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
-		0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
-		0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
-		0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
-		0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
-
-	// Initial hash values
-	uint32_t h0 = 0x6a09e667, h1 = 0xbb67ae85, h2 = 0x3c6ef372, h3 = 0xa54ff53a;
-	uint32_t h4 = 0x510e527f, h5 = 0x9b05688c, h6 = 0x1f83d9ab, h7 = 0x5be0cd19;
-
-	// Prepare message
-	uint64_t	bit_len	   = len * 8;
-	std::size_t padded_len = ((len + 8) / 64 + 1) * 64;
-	uint8_t		msg[1024]{};  // Support up to reasonable string lengths
-
-	for (std::size_t i = 0; i < len; ++i)
-		msg[i] = static_cast<uint8_t>(data[i]);
-	msg[len] = 0x80;
-
-	// Append length
-	for (int i = 0; i < 8; ++i)
+	return crc32_update(0, data, len);
+}
+
+// === SHA-2 CONSTANTS ===
+
+// SHA-256 round constants
+inline constexpr uint32_t sha256_k[64] = {
+	0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+	0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+	0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+	0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+	0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+	0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+	0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+	0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+// SHA-256 initial hash values
+inline constexpr uint32_t sha256_init[8] = {
+	0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+
+// SHA-512 round constants
+inline constexpr uint64_t sha512_k[80] = {
+	0x428a2f98d728ae22ULL, 0x7137449123ef65cdULL, 0xb5c0fbcfec4d3b2fULL, 0xe9b5dba58189dbbcULL,
+	0x3956c25bf348b538ULL, 0x59f111f1b605d019ULL, 0x923f82a4af194f9bULL, 0xab1c5ed5da6d8118ULL,
+	0xd807aa98a3030242ULL, 0x12835b0145706fbeULL, 0x243185be4ee4b28cULL, 0x550c7dc3d5ffb4e2ULL,
+	0x72be5d74f27b896fULL, 0x80deb1fe3b1696b1ULL, 0x9bdc06a725c71235ULL, 0xc19bf174cf692694ULL,
+	0xe49b69c19ef14ad2ULL, 0xefbe4786384f25e3ULL, 0x0fc19dc68b8cd5b5ULL, 0x240ca1cc77ac9c65ULL,
+	0x2de92c6f592b0275ULL, 0x4a7484aa6ea6e483ULL, 0x5cb0a9dcbd41fbd4ULL, 0x76f988da831153b5ULL,
+	0x983e5152ee66dfabULL, 0xa831c66d2db43210ULL, 0xb00327c898fb213fULL, 0xbf597fc7beef0ee4ULL,
+	0xc6e00bf33da88fc2ULL, 0xd5a79147930aa725ULL, 0x06ca6351e003826fULL, 0x142929670a0e6e70ULL,
+	0x27b70a8546d22ffcULL, 0x2e1b21385c26c926ULL, 0x4d2c6dfc5ac42aedULL, 0x53380d139d95b3dfULL,
+	0x650a73548baf63deULL, 0x766a0abb3c77b2a8ULL, 0x81c2c92e47edaee6ULL, 0x92722c851482353bULL,
+	0xa2bfe8a14cf10364ULL, 0xa81a664bbc423001ULL, 0xc24b8b70d0f89791ULL, 0xc76c51a30654be30ULL,
+	0xd192e819d6ef5218ULL, 0xd69906245565a910ULL, 0xf40e35855771202aULL, 0x106aa07032bbd1b8ULL,
+	0x19a4c116b8d2d0c8ULL, 0x1e376c085141ab53ULL, 0x2748774cdf8eeb99ULL, 0x34b0bcb5e19b48a8ULL,
+	0x391c0cb3c5c95a63ULL, 0x4ed8aa4ae3418acbULL, 0x5b9cca4f7763e373ULL, 0x682e6ff3d6b2b8a3ULL,
+	0x748f82ee5defb2fcULL, 0x78a5636f43172f60ULL, 0x84c87814a1f0ab72ULL, 0x8cc702081a6439ecULL,
+	0x90befffa23631e28ULL, 0xa4506cebde82bde9ULL, 0xbef9a3f7b2c67915ULL, 0xc67178f2e372532bULL,
+	0xca273eceea26619cULL, 0xd186b8c721c0c207ULL, 0xeada7dd6cde0eb1eULL, 0xf57d4f7fee6ed178ULL,
+	0x06f067aa72176fbaULL, 0x0a637dc5a2c898a6ULL, 0x113f9804bef90daeULL, 0x1b710b35131c471bULL,
+	0x28db77f523047d84ULL, 0x32caab7b40c72493ULL, 0x3c9ebe0a15c9bebcULL, 0x431d67c49c100d4cULL,
+	0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL, 0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL};
+
+// SHA-512 initial hash values
+inline constexpr uint64_t sha512_init[8] = {
+	0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL, 0x3c6ef372fe94f82bULL, 0xa54ff53a5f1d36f1ULL,
+	0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL, 0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL};
+
+// === SHA-2 COMPRESSION FUNCTIONS ===
+
+// Process one 64-byte block, read in place from any byte-sized character type
+constexpr void sha256_compress(uint32_t (&state)[8], const auto* block)
+{
+	static_assert(sizeof(block[0]) == 1, "sha256_compress: data type must be byte-sized");
+
+	uint32_t w[64]{};
+
+	// Copy block into w[0..15]
+	for (int i = 0; i < 16; ++i)
 	{
-		msg[padded_len - 1 - i] = static_cast<uint8_t>(bit_len >> (i * 8));
+		w[i] = (static_cast<uint32_t>(static_cast<uint8_t>(block[i * 4])) << 24) |
+			   (static_cast<uint32_t>(static_cast<uint8_t>(block[i * 4 + 1])) << 16) |
+			   (static_cast<uint32_t>(static_cast<uint8_t>(block[i * 4 + 2])) << 8) |
+			   (static_cast<uint32_t>(static_cast<uint8_t>(block[i * 4 + 3])));
 	}
 
-	// Process chunks
-	for (std::size_t chunk = 0; chunk < padded_len / 64; ++chunk)
+	// Extend w[16..63]
+	for (int i = 16; i < 64; ++i)
 	{
-		uint32_t w[64]{};
+		uint32_t s0 =
+			((w[i - 15] >> 7) | (w[i - 15] << 25)) ^ ((w[i - 15] >> 18) | (w[i - 15] << 14)) ^ (w[i - 15] >> 3);
+		uint32_t s1 = ((w[i - 2] >> 17) | (w[i - 2] << 15)) ^ ((w[i - 2] >> 19) | (w[i - 2] << 13)) ^ (w[i - 2] >> 10);
+		w[i]		= w[i - 16] + s0 + w[i - 7] + s1;
+	}
 
-		// Copy chunk into w[0.. 15]
-		for (int i = 0; i < 16; ++i)
-		{
-			w[i] = (static_cast<uint32_t>(msg[chunk * 64 + i * 4]) << 24) |
-				   (static_cast<uint32_t>(msg[chunk * 64 + i * 4 + 1]) << 16) |
-				   (static_cast<uint32_t>(msg[chunk * 64 + i * 4 + 2]) << 8) |
-				   (static_cast<uint32_t>(msg[chunk * 64 + i * 4 + 3]));
-		}
+	// Compression
+	uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+	uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
 
-		// Extend w[16..63]
-		for (int i = 16; i < 64; ++i)
-		{
-			uint32_t s0 =
-				((w[i - 15] >> 7) | (w[i - 15] << 25)) ^ ((w[i - 15] >> 18) | (w[i - 15] << 14)) ^ (w[i - 15] >> 3);
-			uint32_t s1 =
-				((w[i - 2] >> 17) | (w[i - 2] << 15)) ^ ((w[i - 2] >> 19) | (w[i - 2] << 13)) ^ (w[i - 2] >> 10);
-			w[i] = w[i - 16] + s0 + w[i - 7] + s1;
-		}
+	for (int i = 0; i < 64; ++i)
+	{
+		uint32_t S1	   = ((e >> 6) | (e << 26)) ^ ((e >> 11) | (e << 21)) ^ ((e >> 25) | (e << 7));
+		uint32_t ch	   = (e & f) ^ ((~e) & g);
+		uint32_t temp1 = h + S1 + ch + sha256_k[i] + w[i];
+		uint32_t S0	   = ((a >> 2) | (a << 30)) ^ ((a >> 13) | (a << 19)) ^ ((a >> 22) | (a << 10));
+		uint32_t maj   = (a & b) ^ (a & c) ^ (b & c);
+		uint32_t temp2 = S0 + maj;
+
+		h = g;
+		g = f;
+		f = e;
+		e = d + temp1;
+		d = c;
+		c = b;
+		b = a;
+		a = temp1 + temp2;
+	}
 
-		// Compression
-		uint32_t a = h0, b = h1, c = h2, d = h3, e = h4, f = h5, g = h6, h = h7;
+	state[0] += a;
+	state[1] += b;
+	state[2] += c;
+	state[3] += d;
+	state[4] += e;
+	state[5] += f;
+	state[6] += g;
+	state[7] += h;
+}
 
-		for (int i = 0; i < 64; ++i)
-		{
-			uint32_t S1	   = ((e >> 6) | (e << 26)) ^ ((e >> 11) | (e << 21)) ^ ((e >> 25) | (e << 7));
-			uint32_t ch	   = (e & f) ^ ((~e) & g);
-			uint32_t temp1 = h + S1 + ch + K[i] + w[i];
-			uint32_t S0	   = ((a >> 2) | (a << 30)) ^ ((a >> 13) | (a << 19)) ^ ((a >> 22) | (a << 10));
-			uint32_t maj   = (a & b) ^ (a & c) ^ (b & c);
-			uint32_t temp2 = S0 + maj;
-
-			h = g;
-			g = f;
-			f = e;
-			e = d + temp1;
-			d = c;
-			c = b;
-			b = a;
-			a = temp1 + temp2;
-		}
+// Process one 128-byte block, read in place from any byte-sized character type
+constexpr void sha512_compress(uint64_t (&state)[8], const auto* block)
+{
+	static_assert(sizeof(block[0]) == 1, "sha512_compress: data type must be byte-sized");
+
+	uint64_t w[80]{};
 
-		h0 += a;
-		h1 += b;
-		h2 += c;
-		h3 += d;
-		h4 += e;
-		h5 += f;
-		h6 += g;
-		h7 += h;
+	// Copy block into w[0..15]
+	for (int i = 0; i < 16; ++i)
+	{
+		uint64_t word = 0;
+		for (int j = 0; j < 8; ++j)
+			word = (word << 8) | static_cast<uint8_t>(block[i * 8 + j]);
+		w[i] = word;
 	}
 
-	// Produce final hash
-	FixedBytes<32> result{};
-	for (int i = 0; i < 4; ++i)
+	// Extend w[16..79]
+	for (int i = 16; i < 80; ++i)
 	{
-		result.data[i]		= (h0 >> (24 - i * 8)) & 0xFF;
-		result.data[4 + i]	= (h1 >> (24 - i * 8)) & 0xFF;
-		result.data[8 + i]	= (h2 >> (24 - i * 8)) & 0xFF;
-		result.data[12 + i] = (h3 >> (24 - i * 8)) & 0xFF;
-		result.data[16 + i] = (h4 >> (24 - i * 8)) & 0xFF;
-		result.data[20 + i] = (h5 >> (24 - i * 8)) & 0xFF;
-		result.data[24 + i] = (h6 >> (24 - i * 8)) & 0xFF;
-		result.data[28 + i] = (h7 >> (24 - i * 8)) & 0xFF;
+		uint64_t s0 =
+			((w[i - 15] >> 1) | (w[i - 15] << 63)) ^ ((w[i - 15] >> 8) | (w[i - 15] << 56)) ^ (w[i - 15] >> 7);
+		uint64_t s1 = ((w[i - 2] >> 19) | (w[i - 2] << 45)) ^ ((w[i - 2] >> 61) | (w[i - 2] << 3)) ^ (w[i - 2] >> 6);
+		w[i]		= w[i - 16] + s0 + w[i - 7] + s1;
 	}
 
-	return result;
+	// Compression
+	uint64_t a = state[0], b = state[1], c = state[2], d = state[3];
+	uint64_t e = state[4], f = state[5], g = state[6], h = state[7];
+
+	for (int i = 0; i < 80; ++i)
+	{
+		uint64_t S1	   = ((e >> 14) | (e << 50)) ^ ((e >> 18) | (e << 46)) ^ ((e >> 41) | (e << 23));
+		uint64_t ch	   = (e & f) ^ ((~e) & g);
+		uint64_t temp1 = h + S1 + ch + sha512_k[i] + w[i];
+		uint64_t S0	   = ((a >> 28) | (a << 36)) ^ ((a >> 34) | (a << 30)) ^ ((a >> 39) | (a << 25));
+		uint64_t maj   = (a & b) ^ (a & c) ^ (b & c);
+		uint64_t temp2 = S0 + maj;
+
+		h = g;
+		g = f;
+		f = e;
+		e = d + temp1;
+		d = c;
+		c = b;
+		b = a;
+		a = temp1 + temp2;
+	}
+
+	state[0] += a;
+	state[1] += b;
+	state[2] += c;
+	state[3] += d;
+	state[4] += e;
+	state[5] += f;
+	state[6] += g;
+	state[7] += h;
 }
 
-consteval FixedBytes<64> sha512_compute(const auto* data, std::size_t len)
+// === SHA-2 STREAMING ENGINE ===
+
+struct Sha256Traits
 {
-	// SHA-512 constants
-	constexpr uint64_t K[80] = {
-		0x428a2f98d728ae22ULL, 0x7137449123ef65cdULL, 0xb5c0fbcfec4d3b2fULL, 0xe9b5dba58189dbbcULL,
-		0x3956c25bf348b538ULL, 0x59f111f1b605d019ULL, 0x923f82a4af194f9bULL, 0xab1c5ed5da6d8118ULL,
-		0xd807aa98a3030242ULL, 0x12835b0145706fbeULL, 0x243185be4ee4b28cULL, 0x550c7dc3d5ffb4e2ULL,
-		0x72be5d74f27b896fULL, 0x80deb1fe3b1696b1ULL, 0x9bdc06a725c71235ULL, 0xc19bf174cf692694ULL,
-		0xe49b69c19ef14ad2ULL, 0xefbe4786384f25e3ULL, 0x0fc19dc68b8cd5b5ULL, 0x240ca1cc77ac9c65ULL,
-		0x2de92c6f592b0275ULL, 0x4a7484aa6ea6e483ULL, 0x5cb0a9dcbd41fbd4ULL, 0x76f988da831153b5ULL,
-		0x983e5152ee66dfabULL, 0xa831c66d2db43210ULL, 0xb00327c898fb213fULL, 0xbf597fc7beef0ee4ULL,
-		0xc6e00bf33da88fc2ULL, 0xd5a79147930aa725ULL, 0x06ca6351e003826fULL, 0x142929670a0e6e70ULL,
-		0x27b70a8546d22ffcULL, 0x2e1b21385c26c926ULL, 0x4d2c6dfc5ac42aedULL, 0x53380d139d95b3dfULL,
-		0x650a73548baf63deULL, 0x766a0abb3c77b2a8ULL, 0x81c2c92e47edaee6ULL, 0x92722c851482353bULL,
-		0xa2bfe8a14cf10364ULL, 0xa81a664bbc423001ULL, 0xc24b8b70d0f89791ULL, 0xc76c51a30654be30ULL,
-		0xd192e819d6ef5218ULL, 0xd69906245565a910ULL, 0xf40e35855771202aULL, 0x106aa07032bbd1b8ULL,
-		0x19a4c116b8d2d0c8ULL, 0x1e376c085141ab53ULL, 0x2748774cdf8eeb99ULL, 0x34b0bcb5e19b48a8ULL,
-		0x391c0cb3c5c95a63ULL, 0x4ed8aa4ae3418acbULL, 0x5b9cca4f7763e373ULL, 0x682e6ff3d6b2b8a3ULL,
-		0x748f82ee5defb2fcULL, 0x78a5636f43172f60ULL, 0x84c87814a1f0ab72ULL, 0x8cc702081a6439ecULL,
-		0x90befffa23631e28ULL, 0xa4506cebde82bde9ULL, 0xbef9a3f7b2c67915ULL, 0xc67178f2e372532bULL,
-		0xca273eceea26619cULL, 0xd186b8c721c0c207ULL, 0xeada7dd6cde0eb1eULL, 0xf57d4f7fee6ed178ULL,
-		0x06f067aa72176fbaULL, 0x0a637dc5a2c898a6ULL, 0x113f9804bef90daeULL, 0x1b710b35131c471bULL,
-		0x28db77f523047d84ULL, 0x32caab7b40c72493ULL, 0x3c9ebe0a15c9bebcULL, 0x431d67c49c100d4cULL,
-		0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL, 0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL};
-
-	// Initial hash values
-	uint64_t h0 = 0x6a09e667f3bcc908ULL, h1 = 0xbb67ae8584caa73bULL;
-	uint64_t h2 = 0x3c6ef372fe94f82bULL, h3 = 0xa54ff53a5f1d36f1ULL;
-	uint64_t h4 = 0x510e527fade682d1ULL, h5 = 0x9b05688c2b3e6c1fULL;
-	uint64_t h6 = 0x1f83d9abfb41bd6bULL, h7 = 0x5be0cd19137e2179ULL;
-
-	// Prepare message
-	uint64_t	bit_len	   = len * 8;
-	std::size_t padded_len = ((len + 16) / 128 + 1) * 128;
-	uint8_t		msg[2048]{};  // Support reasonable string lengths
-
-	for (std::size_t i = 0; i < len; ++i)
-		msg[i] = static_cast<uint8_t>(data[i]);
-	msg[len] = 0x80;
-
-	// Append length (big-endian)
-	for (int i = 0; i < 8; ++i)
+	using word_type								   = uint32_t;
+	static constexpr std::size_t	 block_size	   = 64;
+	static constexpr std::size_t	 length_size   = 8;
+	static constexpr std::size_t	 digest_size   = 32;
+	static constexpr const uint32_t* initial_state = sha256_init;
+
+	static constexpr void compress_blocks(uint32_t (&state)[8], const auto* data, std::size_t blocks)
 	{
-		msg[padded_len - 1 - i] = static_cast<uint8_t>(bit_len >> (i * 8));
+		for (std::size_t i = 0; i < blocks; ++i)
+			sha256_compress(state, data + i * block_size);
 	}
+};
 
-	// Process chunks
-	for (std::size_t chunk = 0; chunk < padded_len / 128; ++chunk)
+struct Sha512Traits
+{
+	using word_type								   = uint64_t;
+	static constexpr std::size_t	 block_size	   = 128;
+	static constexpr std::size_t	 length_size   = 16;
+	static constexpr std::size_t	 digest_size   = 64;
+	static constexpr const uint64_t* initial_state = sha512_init;
+
+	static constexpr void compress_blocks(uint64_t (&state)[8], const auto* data, std::size_t blocks)
 	{
-		uint64_t w[80]{};
+		for (std::size_t i = 0; i < blocks; ++i)
+			sha512_compress(state, data + i * block_size);
+	}
+};
+
+// Block-based SHA-2 engine. Whole blocks are compressed directly from the caller's data; only a partial
+// trailing block is buffered, so inputs of any length can be hashed, in one call or incrementally.
+// Traits::compress_blocks processes a run of consecutive blocks, which lets the runtime engines
+// (rt_sha.hpp) reuse this buffering and padding with hardware-accelerated block functions.
+template <typename Traits>
+struct Sha2Engine
+{
+	using word_type							 = typename Traits::word_type;
+	static constexpr std::size_t block_size	 = Traits::block_size;
+	static constexpr std::size_t digest_size = Traits::digest_size;
 
-		// Copy chunk into w[0..15]
-		for (int i = 0; i < 16; ++i)
-		{
-			w[i] = (static_cast<uint64_t>(msg[chunk * 128 + i * 8]) << 56) |
-				   (static_cast<uint64_t>(msg[chunk * 128 + i * 8 + 1]) << 48) |
-				   (static_cast<uint64_t>(msg[chunk * 128 + i * 8 + 2]) << 40) |
-				   (static_cast<uint64_t>(msg[chunk * 128 + i * 8 + 3]) << 32) |
-				   (static_cast<uint64_t>(msg[chunk * 128 + i * 8 + 4]) << 24) |
-				   (static_cast<uint64_t>(msg[chunk * 128 + i * 8 + 5]) << 16) |
-				   (static_cast<uint64_t>(msg[chunk * 128 + i * 8 + 6]) << 8) |
-				   (static_cast<uint64_t>(msg[chunk * 128 + i * 8 + 7]));
-		}
+	word_type	state[8]{};
+	uint8_t		buffer[block_size]{};
+	std::size_t buffered = 0;
+	uint64_t	total	 = 0;
+
+	constexpr Sha2Engine()
+	{
+		for (std::size_t i = 0; i < 8; ++i)
+			state[i] = Traits::initial_state[i];
+	}
+
+	constexpr Sha2Engine& update(const auto* data, std::size_t len)
+	{
+		static_assert(sizeof(data[0]) == 1, "Sha2Engine::update: data type must be byte-sized");
+
+		total += len;
+		std::size_t pos = 0;
 
-		// Extend w[16..79]
-		for (int i = 16; i < 80; ++i)
+		// Top up a previously buffered partial block
+		if (buffered > 0)
 		{
-			uint64_t s0 =
-				((w[i - 15] >> 1) | (w[i - 15] << 63)) ^ ((w[i - 15] >> 8) | (w[i - 15] << 56)) ^ (w[i - 15] >> 7);
-			uint64_t s1 =
-				((w[i - 2] >> 19) | (w[i - 2] << 45)) ^ ((w[i - 2] >> 61) | (w[i - 2] << 3)) ^ (w[i - 2] >> 6);
-			w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+			while (buffered < block_size && pos < len)
+				buffer[buffered++] = static_cast<uint8_t>(data[pos++]);
+			if (buffered < block_size)
+				return *this;
+			Traits::compress_blocks(state, buffer, 1);
+			buffered = 0;
 		}
 
-		// Compression
-		uint64_t a = h0, b = h1, c = h2, d = h3, e = h4, f = h5, g = h6, h = h7;
-
-		for (int i = 0; i < 80; ++i)
+		// Compress whole blocks in place
+		const std::size_t blocks = (len - pos) / block_size;
+		if (blocks > 0)
 		{
-			uint64_t S1	   = ((e >> 14) | (e << 50)) ^ ((e >> 18) | (e << 46)) ^ ((e >> 41) | (e << 23));
-			uint64_t ch	   = (e & f) ^ ((~e) & g);
-			uint64_t temp1 = h + S1 + ch + K[i] + w[i];
-			uint64_t S0	   = ((a >> 28) | (a << 36)) ^ ((a >> 34) | (a << 30)) ^ ((a >> 39) | (a << 25));
-			uint64_t maj   = (a & b) ^ (a & c) ^ (b & c);
-			uint64_t temp2 = S0 + maj;
-
-			h = g;
-			g = f;
-			f = e;
-			e = d + temp1;
-			d = c;
-			c = b;
-			b = a;
-			a = temp1 + temp2;
+			Traits::compress_blocks(state, data + pos, blocks);
+			pos += blocks * block_size;
 		}
 
-		h0 += a;
-		h1 += b;
-		h2 += c;
-		h3 += d;
-		h4 += e;
-		h5 += f;
-		h6 += g;
-		h7 += h;
+		// Keep the remainder for the next update or for padding
+		while (pos < len)
+			buffer[buffered++] = static_cast<uint8_t>(data[pos++]);
+		return *this;
 	}
 
-	// Produce final hash
-	FixedBytes<64> result{};
-	for (int i = 0; i < 8; ++i)
+	constexpr FixedBytes<digest_size> finish()
 	{
-		result.data[i]		= (h0 >> (56 - i * 8)) & 0xFF;
-		result.data[8 + i]	= (h1 >> (56 - i * 8)) & 0xFF;
-		result.data[16 + i] = (h2 >> (56 - i * 8)) & 0xFF;
-		result.data[24 + i] = (h3 >> (56 - i * 8)) & 0xFF;
-		result.data[32 + i] = (h4 >> (56 - i * 8)) & 0xFF;
-		result.data[40 + i] = (h5 >> (56 - i * 8)) & 0xFF;
-		result.data[48 + i] = (h6 >> (56 - i * 8)) & 0xFF;
-		result.data[56 + i] = (h7 >> (56 - i * 8)) & 0xFF;
+		const uint64_t bit_len = total * 8;
+
+		// Pad the final block; spill into a second block when the length field does not fit
+		buffer[buffered++] = 0x80;
+		if (buffered > block_size - Traits::length_size)
+		{
+			while (buffered < block_size)
+				buffer[buffered++] = 0;
+			Traits::compress_blocks(state, buffer, 1);
+			buffered = 0;
+		}
+		while (buffered < block_size)
+			buffer[buffered++] = 0;
+
+		// Append length (big-endian)
+		for (int i = 0; i < 8; ++i)
+			buffer[block_size - 1 - i] = static_cast<uint8_t>(bit_len >> (i * 8));
+		Traits::compress_blocks(state, buffer, 1);
+		buffered = 0;
+
+		// Produce final hash
+		constexpr std::size_t word_size = sizeof(word_type);
+		FixedBytes<digest_size> result{};
+		for (std::size_t i = 0; i < 8; ++i)
+		{
+			for (std::size_t j = 0; j < word_size; ++j)
+				result.data[i * word_size + j] = static_cast<uint8_t>(state[i] >> ((word_size - 1 - j) * 8));
+		}
+		return result;
 	}
+};
+
+using Sha256Engine = Sha2Engine<Sha256Traits>;
+using Sha512Engine = Sha2Engine<Sha512Traits>;
 
-	return result;
+consteval FixedBytes<32> sha256_compute(const auto* data, std::size_t len)
+{
+	return Sha256Engine{}.update(data, len).finish();
+}
+
+consteval FixedBytes<64> sha512_compute(const auto* data, std::size_t len)
+{
+	return Sha512Engine{}.update(data, len).finish();
 }
 
 // === HASH LOGIC FUNCTIONS ===
@@ -0,0 +1,106 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ct_str
+{
+
+// Helpers for the types built from a pack of FixedString keys (perfect_map, string_switch), plus the
+// word-at-a-time loads and compares their runtime lookups share with the searchers.
+// Packs are expanded into arrays rather than fold expressions, so that sets of many thousands of keys do not
+// build deeply nested expressions. Passing a large pack on to another template is itself costly, so each
+// public type hands its pack to a single *_logic function and derives everything else from the result.
+
+template <typename First, typename... Rest>
+constexpr const First& key_pack_first(const First& first, const Rest&...)
+{
+	return first;
+}
+
+template <std::size_t N>
+constexpr std::size_t key_pack_total(const std::size_t (&lengths)[N])
+{
+	std::size_t total = 0;
+	for (std::size_t len : lengths)
+		total += len;
+	return total;
+}
+
+template <std::size_t N>
+constexpr std::size_t key_pack_max(const std::size_t (&lengths)[N])
+{
+	std::size_t longest = 0;
+	for (std::size_t len : lengths)
+		longest = len > longest ? len : longest;
+	return longest;
+}
+
+template <std::size_t N>
+constexpr bool key_pack_all(const bool (&flags)[N])
+{
+	for (bool flag : flags)
+	{
+		if (!flag)
+			return false;
+	}
+	return true;
+}
+
+// Little-endian load of Bytes byte-sized characters, for runtime lookups that compare or hash keys a word at a
+// time. Written out in full, since loops of byte loads are not merged into a single load at -O2.
+template <std::size_t Bytes, typename CharT>
+constexpr uint64_t key_load_le(const CharT* p)
+{
+	static_assert(sizeof(CharT) == 1, "key_load_le: character type must be byte-sized");
+	static_assert(Bytes == 2 || Bytes == 4 || Bytes == 8, "key_load_le: unsupported width");
+
+	auto byte = [p](std::size_t i) { return static_cast<uint64_t>(static_cast<uint8_t>(p[i])); };
+	if constexpr (Bytes == 2)
+		return byte(0) | (byte(1) << 8);
+	else if constexpr (Bytes == 4)
+		return byte(0) | (byte(1) << 8) | (byte(2) << 16) | (byte(3) << 24);
+	else
+		return byte(0) | (byte(1) << 8) | (byte(2) << 16) | (byte(3) << 24) | (byte(4) << 32) | (byte(5) << 40) |
+			   (byte(6) << 48) | (byte(7) << 56);
+}
+
+// Equality of two strings of the same length. Byte-sized characters are compared a word at a time, with the
+// last word overlapping the previous one instead of a byte-wise tail.
+template <typename CharT>
+constexpr bool key_equal(const CharT* a, const CharT* b, std::size_t len)
+{
+	if constexpr (sizeof(CharT) == 1)
+	{
+		if (len >= 8)
+		{
+			for (std::size_t i = 0; i + 8 < len; i += 8)
+			{
+				if (key_load_le<8>(a + i) != key_load_le<8>(b + i))
+					return false;
+			}
+			return key_load_le<8>(a + len - 8) == key_load_le<8>(b + len - 8);
+		}
+		if (len >= 4)
+			return key_load_le<4>(a) == key_load_le<4>(b) && key_load_le<4>(a + len - 4) == key_load_le<4>(b + len - 4);
+		if (len >= 2)
+			return key_load_le<2>(a) == key_load_le<2>(b) && key_load_le<2>(a + len - 2) == key_load_le<2>(b + len - 2);
+		return len == 0 || a[0] == b[0];
+	}
+	else
+	{
+		for (std::size_t i = 0; i < len; ++i)
+		{
+			if (a[i] != b[i])
+				return false;
+		}
+		return true;
+	}
+}
+
+}  // namespace ct_str
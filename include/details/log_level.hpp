@@ -0,0 +1,164 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#pragma once
+
+#include "fixed_string.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+namespace ct_str
+{
+
+// === LOG LEVELS ===
+
+enum class LogLevel : uint8_t
+{
+	trace,
+	debug,
+	info,
+	warn,
+	error,
+	off
+};
+
+// One row of a LogLevels table: the lowest level compiled in for Module. Module is any name the call sites agree
+// on, typically the stem of the source file (ct_str::stem<__FILE__>) or a tag such as "net".
+template <FixedString Module, LogLevel Level>
+struct ModuleLevel
+{
+	static_assert(std::is_same_v<typename decltype(Module)::value_type, char>,
+				  "ModuleLevel: module name must be narrow");
+
+	static constexpr std::string_view module = std::string_view(Module.data, Module.size());
+	static constexpr LogLevel		  level	 = Level;
+};
+
+template <typename... Modules>
+consteval bool log_levels_unique()
+{
+	constexpr std::string_view names[] = {Modules::module..., std::string_view()};
+	for (std::size_t i = 0; i < sizeof...(Modules); ++i)
+	{
+		for (std::size_t j = i + 1; j < sizeof...(Modules); ++j)
+		{
+			if (names[i] == names[j])
+				return false;
+		}
+	}
+	return true;
+}
+
+// Per-module log levels. Each module gets a compile-time floor from its row (Default for modules not listed), and
+// a runtime level, starting at the floor, that can be raised and lowered again while the program runs. A call
+// below the floor is discarded when it is compiled; any other call costs one relaxed atomic load and a compare.
+//
+//	using Levels = ct_str::LogLevels<ct_str::LogLevel::info,
+//									 ct_str::ModuleLevel<"parser", ct_str::LogLevel::debug>,
+//									 ct_str::ModuleLevel<"net", ct_str::LogLevel::warn>>;
+//	using this_module = ct_str::stem<__FILE__>;
+//
+//	if constexpr (Levels::compiled_in<ct_str::LogLevel::debug, this_module::fwd>)
+//	{
+//		if (Levels::enabled<ct_str::LogLevel::debug, this_module::fwd>())
+//			...
+//	}
+//
+// Modules that are not listed share one runtime level.
+template <LogLevel Default, typename... Modules>
+struct LogLevels
+{
+	static_assert(log_levels_unique<Modules...>(), "LogLevels: a module is listed twice");
+
+	static constexpr std::size_t modules = sizeof...(Modules);
+
+	// The floor of each row, then Default for the shared row
+	static constexpr LogLevel floors[] = {Modules::level..., Default};
+
+	// Row of Module in the table, or modules (the shared row) if it is not listed
+	template <FixedString Module>
+	static consteval std::size_t row()
+	{
+		constexpr std::string_view names[] = {Modules::module..., std::string_view()};
+		const std::string_view	   name(Module.data, Module.size());
+		for (std::size_t i = 0; i < modules; ++i)
+		{
+			if (names[i] == name)
+				return i;
+		}
+		return modules;
+	}
+
+	// Lowest level compiled in for Module
+	template <FixedString Module>
+	static constexpr LogLevel floor = floors[row<Module>()];
+
+	template <LogLevel Level, FixedString Module>
+	static constexpr bool compiled_in = Level != LogLevel::off && Level >= floor<Module>;
+
+	// Whether a message at Level from Module is logged. A constant false below the floor.
+	template <LogLevel Level, FixedString Module>
+	static bool enabled()
+	{
+		if constexpr (!compiled_in<Level, Module>)
+			return false;
+		else
+			return Level >= levels_[row<Module>()].load(std::memory_order_relaxed);
+	}
+
+	template <FixedString Module>
+	static LogLevel level()
+	{
+		return levels_[row<Module>()].load(std::memory_order_relaxed);
+	}
+
+	// Sets Module's runtime level, which cannot go below its floor; returns the level now in effect
+	template <FixedString Module>
+	static LogLevel set_level(LogLevel level)
+	{
+		return store(row<Module>(), level);
+	}
+
+	// The same for a module named at runtime, such as from a config file or a command line; "*" sets every row.
+	// Returns nullopt, and changes nothing, for a name that is not listed, so a misspelled name can be reported.
+	static std::optional<LogLevel> set_level(std::string_view module, LogLevel level)
+	{
+		if (module == "*")
+		{
+			for (std::size_t i = 0; i < modules; ++i)
+				store(i, level);
+			return store(modules, level);
+		}
+		constexpr std::string_view names[] = {Modules::module..., std::string_view()};
+		for (std::size_t i = 0; i < modules; ++i)
+		{
+			if (names[i] == module)
+				return store(i, level);
+		}
+		return std::nullopt;
+	}
+
+	// Sets the level shared by the modules that are not listed
+	static LogLevel set_default_level(LogLevel level)
+	{
+		return store(modules, level);
+	}
+
+private:
+	static LogLevel store(std::size_t index, LogLevel level)
+	{
+		const LogLevel effective = level < floors[index] ? floors[index] : level;
+		levels_[index].store(effective, std::memory_order_relaxed);
+		return effective;
+	}
+
+	static inline std::atomic<LogLevel> levels_[modules + 1] = {Modules::level..., Default};
+};
+
+}  // namespace ct_str
@@ -0,0 +1,233 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace ct_str
+{
+
+// === DIGIT TABLES ===
+
+// "00" through "99": decimal numbers are written two digits per lookup, from the least significant end
+struct DigitPairs
+{
+	char data[200];
+};
+
+consteval DigitPairs make_digit_pairs()
+{
+	DigitPairs pairs{};
+	for (int i = 0; i < 100; ++i)
+	{
+		pairs.data[i * 2]	  = static_cast<char>('0' + i / 10);
+		pairs.data[i * 2 + 1] = static_cast<char>('0' + i % 10);
+	}
+	return pairs;
+}
+
+// Built once per program and shared by compile-time and runtime formatting
+inline constexpr DigitPairs digit_pairs = make_digit_pairs();
+
+struct PowersOf10
+{
+	uint64_t value[20];
+};
+
+consteval PowersOf10 make_powers_of_10()
+{
+	PowersOf10 powers{};
+	uint64_t   p = 1;
+	for (std::size_t i = 0; i < 20; ++i, p *= 10)
+		powers.value[i] = p;
+	return powers;
+}
+
+inline constexpr PowersOf10 powers_of_10 = make_powers_of_10();
+
+// "00" through "ff": hexadecimal numbers are written one byte per lookup
+struct HexPairs
+{
+	char data[512];
+};
+
+consteval HexPairs make_hex_pairs()
+{
+	constexpr char hex_chars[] = "0123456789abcdef";
+	HexPairs	   pairs{};
+	for (int i = 0; i < 256; ++i)
+	{
+		pairs.data[i * 2]	  = hex_chars[i >> 4];
+		pairs.data[i * 2 + 1] = hex_chars[i & 0x0F];
+	}
+	return pairs;
+}
+
+inline constexpr HexPairs hex_pairs = make_hex_pairs();
+
+// Digits of every base up to 36
+inline constexpr char digit_chars[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+// === DECIMAL OUTPUT ===
+
+// Number of decimal digits in v (1 for 0). bit_width * 1233 / 4096 approximates log10 from below, so one
+// comparison against the power table corrects it.
+constexpr unsigned decimal_length(uint64_t v)
+{
+	v |= 1;
+	const unsigned guess = static_cast<unsigned>(std::bit_width(v)) * 1233 >> 12;
+	return guess + (v >= powers_of_10.value[guess]);
+}
+
+// Writes the len = decimal_length(v) digits of v to out and returns the end
+constexpr char* write_decimal(char* out, uint64_t v, unsigned len)
+{
+	char* end = out + len;
+	char* p	  = end;
+	while (v >= 100)
+	{
+		const auto pair = static_cast<std::size_t>(v % 100) * 2;
+		v /= 100;
+		*--p = digit_pairs.data[pair + 1];
+		*--p = digit_pairs.data[pair];
+	}
+	if (v >= 10)
+	{
+		*--p = digit_pairs.data[v * 2 + 1];
+		*--p = digit_pairs.data[v * 2];
+	}
+	else
+		*--p = static_cast<char>('0' + v);
+	return end;
+}
+
+// Writes an integer in decimal, with a leading '-' if it is negative, and returns the end. At most
+// decimal_max_length<T> characters are written.
+template <typename T>
+constexpr char* write_decimal(char* out, T value)
+{
+	static_assert(std::is_integral_v<T>, "write_decimal: integer type required");
+	using U		= std::make_unsigned_t<T>;
+	U magnitude = static_cast<U>(value);
+	if constexpr (std::is_signed_v<T>)
+	{
+		if (value < 0)
+		{
+			*out++	  = '-';
+			magnitude = static_cast<U>(U{0} - magnitude);
+		}
+	}
+	return write_decimal(out, magnitude, decimal_length(magnitude));
+}
+
+template <typename T>
+inline constexpr std::size_t decimal_max_length = std::numeric_limits<T>::digits10 + 1 + std::is_signed_v<T>;
+
+// === OUTPUT IN ANY BASE ===
+
+// Number of digits of v in Base (1 for 0). Power-of-two bases count bits; other bases divide.
+template <unsigned Base>
+constexpr unsigned number_length(uint64_t v)
+{
+	static_assert(Base >= 2 && Base <= 36, "number_length: Base must be between 2 and 36");
+	if constexpr (Base == 10)
+		return decimal_length(v);
+	else if constexpr (std::has_single_bit(Base))
+	{
+		constexpr unsigned bits = static_cast<unsigned>(std::countr_zero(Base));
+		return (static_cast<unsigned>(std::bit_width(v | 1)) + bits - 1) / bits;
+	}
+	else
+	{
+		unsigned len = 1;
+		for (; v >= Base; v /= Base)
+			++len;
+		return len;
+	}
+}
+
+// Writes the len = number_length<Base>(v) digits of v to out and returns the end. Decimal and hexadecimal go
+// through the pair tables; other power-of-two bases shift and mask.
+template <unsigned Base>
+constexpr char* write_digits(char* out, uint64_t v, unsigned len)
+{
+	if constexpr (Base == 10)
+		return write_decimal(out, v, len);
+	else
+	{
+		char* end = out + len;
+		char* p	  = end;
+		if constexpr (Base == 16)
+		{
+			for (; v >= 256; v >>= 8)
+			{
+				const auto pair = static_cast<std::size_t>(v & 0xFF) * 2;
+				*--p			= hex_pairs.data[pair + 1];
+				*--p			= hex_pairs.data[pair];
+			}
+			if (v >= 16)
+			{
+				*--p = hex_pairs.data[v * 2 + 1];
+				*--p = hex_pairs.data[v * 2];
+			}
+			else
+				*--p = digit_chars[v];
+		}
+		else if constexpr (std::has_single_bit(Base))
+		{
+			constexpr unsigned bits = static_cast<unsigned>(std::countr_zero(Base));
+			for (; p != out; v >>= bits)
+				*--p = digit_chars[v & (Base - 1)];
+		}
+		else
+		{
+			for (; p != out; v /= Base)
+				*--p = digit_chars[v % Base];
+		}
+		return end;
+	}
+}
+
+// Writes value in Base, left-padded with fill to at least width characters, and returns the end. Negative
+// values keep their sign in front: zero padding goes between the sign and the digits ("-0042"), any other
+// fill goes before the sign ("  -42"). At most max(width, integer_max_length<T>) characters are written.
+template <unsigned Base, typename T>
+constexpr char* write_integer(char* out, T value, std::size_t width = 0, char fill = '0')
+{
+	static_assert(std::is_integral_v<T>, "write_integer: integer type required");
+	using U		  = std::make_unsigned_t<T>;
+	U	 magnitude = static_cast<U>(value);
+	bool negative  = false;
+	if constexpr (std::is_signed_v<T>)
+	{
+		if (value < 0)
+		{
+			negative  = true;
+			magnitude = static_cast<U>(U{0} - magnitude);
+		}
+	}
+
+	const unsigned	  len	= number_length<Base>(magnitude);
+	const std::size_t total = len + negative;
+	if (negative && fill == '0')
+		*out++ = '-';
+	for (std::size_t pad = width > total ? width - total : 0; pad > 0; --pad)
+		*out++ = fill;
+	if (negative && fill != '0')
+		*out++ = '-';
+	return write_digits<Base>(out, magnitude, len);
+}
+
+// Longest unpadded text of a T in any base: every bit as a binary digit, plus the sign
+template <typename T>
+inline constexpr std::size_t integer_max_length =
+	std::numeric_limits<std::make_unsigned_t<T>>::digits + std::is_signed_v<T>;
+
+}  // namespace ct_str
@@ -0,0 +1,299 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#pragma once
+
+#include "fixed_string.hpp"
+#include "key_pack.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace ct_str
+{
+
+// === PERFECT HASH FUNCTIONS ===
+
+// Final avalanche step; also used to derive a slot from a key hash and a bucket displacement
+constexpr uint64_t phf_mix(uint64_t x)
+{
+	x ^= x >> 32;
+	x *= 0xd6e8feb86659fd93ULL;
+	x ^= x >> 32;
+	x *= 0xd6e8feb86659fd93ULL;
+	x ^= x >> 32;
+	return x;
+}
+
+// Seeded 64-bit string hash, identical at compile time and at runtime. Byte-sized characters are consumed
+// eight at a time; a partial tail is read as one overlapping word, or for keys under eight characters as two
+// overlapping halves, so short keys hash without a byte loop.
+template <typename CharT>
+constexpr uint64_t phf_hash(const CharT* str, std::size_t len, uint64_t seed)
+{
+	constexpr uint64_t mul = 0x9e3779b97f4a7c15ULL;
+	uint64_t		   h   = seed ^ (len * mul);
+
+	auto absorb = [&h](uint64_t word)
+	{
+		h = (h ^ word) * mul;
+		h ^= h >> 29;
+	};
+
+	if constexpr (sizeof(CharT) == 1)
+	{
+		if (len >= 8)
+		{
+			std::size_t i = 0;
+			for (; i + 8 <= len; i += 8)
+				absorb(key_load_le<8>(str + i));
+			if (i < len)
+				absorb(key_load_le<8>(str + len - 8));
+		}
+		else if (len >= 4)
+			absorb(key_load_le<4>(str) | (key_load_le<4>(str + len - 4) << 32));
+		else if (len > 0)
+		{
+			absorb(static_cast<uint64_t>(static_cast<uint8_t>(str[0])) |
+				   (static_cast<uint64_t>(static_cast<uint8_t>(str[len / 2])) << 8) |
+				   (static_cast<uint64_t>(static_cast<uint8_t>(str[len - 1])) << 16));
+		}
+	}
+	else
+	{
+		for (std::size_t i = 0; i < len; ++i)
+			absorb(static_cast<uint64_t>(str[i]));
+	}
+	return phf_mix(h);
+}
+
+// Bucket from the high half of the hash, slot from a remix with the bucket's displacement
+constexpr std::size_t phf_bucket(uint64_t h, std::size_t buckets)
+{
+	return static_cast<std::size_t>(((h >> 32) * buckets) >> 32);
+}
+
+constexpr std::size_t phf_slot(uint64_t h, int32_t displacement, std::size_t slots)
+{
+	const uint64_t x = phf_mix(h ^ (static_cast<uint64_t>(displacement) * 0x9e3779b97f4a7c15ULL));
+	return static_cast<std::size_t>(((x & 0xFFFFFFFF) * slots) >> 32);
+}
+
+// === PERFECT HASH TABLE ===
+
+// Keys are packed into one blob; offsets[i]..offsets[i + 1] is key i. Each bucket holds either a displacement
+// (>= 0) used to rehash its keys into slots, or, for single-key buckets, the slot itself encoded as -(slot + 1).
+// slots maps a slot back to the key's declaration index. One bucket per key keeps the displacement search
+// short, so large key sets build well within the default constexpr operation limits.
+template <typename CharT, std::size_t N, std::size_t BlobSize>
+struct PerfectHashTable
+{
+	using value_type = CharT;
+
+	CharT		blob[BlobSize + 1]{};
+	uint32_t	offsets[N + 1]{};
+	uint32_t	slots[N]{};
+	int32_t		displacement[N]{};
+	uint64_t	seed	  = 0;
+	bool		built	  = false;
+	std::size_t duplicate = N;
+
+	constexpr std::basic_string_view<CharT> key(std::size_t i) const
+	{
+		return {blob + offsets[i], offsets[i + 1] - offsets[i]};
+	}
+
+	constexpr std::size_t slot_of(uint64_t h) const
+	{
+		const int32_t d = displacement[phf_bucket(h, N)];
+		return d < 0 ? static_cast<std::size_t>(-(d + 1)) : phf_slot(h, d, N);
+	}
+};
+
+template <auto... Keys>
+consteval auto perfect_map_logic()
+{
+	using CharT					  = typename std::remove_cvref_t<decltype(key_pack_first(Keys...))>::value_type;
+	constexpr std::size_t n		  = sizeof...(Keys);
+	constexpr std::size_t max_per = 32;	 // larger buckets mean a poor seed; try the next one
+
+	constexpr bool same_char[] = {std::is_same_v<typename decltype(Keys)::value_type, CharT>...};
+	static_assert(key_pack_all(same_char), "perfect_map: all keys must have the same character type");
+
+	constexpr std::size_t lengths[] = {Keys.size()...};
+	const CharT*		  data[]	= {Keys.data...};
+
+	PerfectHashTable<CharT, n, key_pack_total(lengths)> table{};
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		table.offsets[i + 1] = static_cast<uint32_t>(table.offsets[i] + lengths[i]);
+		for (std::size_t j = 0; j < lengths[i]; ++j)
+			table.blob[table.offsets[i] + j] = data[i][j];
+	}
+
+	uint64_t	hashes[n]{};
+	std::size_t bucket_size[n]{};
+	std::size_t bucket_start[n + 1]{};
+	std::size_t members[n]{};
+	bool		taken[n]{};
+
+	for (uint64_t attempt = 0; attempt < 64; ++attempt)
+	{
+		const uint64_t seed = phf_mix(0x243f6a8885a308d3ULL + attempt);
+
+		// Group keys by bucket (counting sort)
+		for (std::size_t b = 0; b < n; ++b)
+			bucket_size[b] = 0;
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			hashes[i] = phf_hash(data[i], lengths[i], seed);
+			++bucket_size[phf_bucket(hashes[i], n)];
+		}
+		std::size_t largest = 0;
+		for (std::size_t b = 0; b < n; ++b)
+		{
+			bucket_start[b + 1] = bucket_start[b] + bucket_size[b];
+			largest				= bucket_size[b] > largest ? bucket_size[b] : largest;
+			bucket_size[b]		= 0;
+		}
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			const std::size_t b					 = phf_bucket(hashes[i], n);
+			members[bucket_start[b] + bucket_size[b]++] = i;
+		}
+		if (largest > max_per)
+			continue;
+
+		// Equal hashes within a bucket are either duplicate keys or a seed that cannot separate two keys
+		bool collision = false;
+		for (std::size_t b = 0; b < n && !collision; ++b)
+		{
+			for (std::size_t x = bucket_start[b]; x < bucket_start[b + 1]; ++x)
+			{
+				for (std::size_t y = x + 1; y < bucket_start[b + 1]; ++y)
+				{
+					if (hashes[members[x]] != hashes[members[y]])
+						continue;
+					if (table.key(members[x]) == table.key(members[y]))
+					{
+						table.duplicate = members[x] > members[y] ? members[x] : members[y];
+						return table;
+					}
+					collision = true;
+				}
+			}
+		}
+		if (collision)
+			continue;
+
+		// Place multi-key buckets, largest first, by searching for a displacement that sends every key in the
+		// bucket to a distinct free slot
+		for (std::size_t s = 0; s < n; ++s)
+			taken[s] = false;
+		bool placed_all = true;
+		for (std::size_t size = largest; size >= 2 && placed_all; --size)
+		{
+			for (std::size_t b = 0; b < n && placed_all; ++b)
+			{
+				if (bucket_start[b + 1] - bucket_start[b] != size)
+					continue;
+
+				bool placed = false;
+				for (int32_t d = 0; d < (1 << 16) && !placed; ++d)
+				{
+					std::size_t chosen[max_per]{};
+					placed = true;
+					for (std::size_t k = 0; k < size && placed; ++k)
+					{
+						chosen[k] = phf_slot(hashes[members[bucket_start[b] + k]], d, n);
+						if (taken[chosen[k]])
+							placed = false;
+						for (std::size_t prev = 0; prev < k && placed; ++prev)
+						{
+							if (chosen[prev] == chosen[k])
+								placed = false;
+						}
+					}
+					if (!placed)
+						continue;
+					table.displacement[b] = d;
+					for (std::size_t k = 0; k < size; ++k)
+					{
+						taken[chosen[k]]		= true;
+						table.slots[chosen[k]] = static_cast<uint32_t>(members[bucket_start[b] + k]);
+					}
+				}
+				placed_all = placed;
+			}
+		}
+		if (!placed_all)
+			continue;
+
+		// Single-key buckets go straight into the remaining free slots
+		std::size_t next_free = 0;
+		for (std::size_t b = 0; b < n; ++b)
+		{
+			if (bucket_start[b + 1] - bucket_start[b] != 1)
+				continue;
+			while (taken[next_free])
+				++next_free;
+			taken[next_free]	  = true;
+			table.slots[next_free] = static_cast<uint32_t>(members[bucket_start[b]]);
+			table.displacement[b] = -static_cast<int32_t>(next_free) - 1;
+		}
+
+		table.seed	= seed;
+		table.built = true;
+		return table;
+	}
+	return table;
+}
+
+// === PERFECT MAP ===
+
+// Compile-time minimal perfect hash over a fixed key set. Each key maps to its position in the template
+// argument list; runtime lookup is one hash, one table read and one key comparison, with no allocation.
+//
+//	using Methods = ct_str::perfect_map<"GET", "PUT", "POST">;
+//	std::size_t i = Methods::find(method);	// 0, 1, 2, or Methods::npos
+template <FixedString... Keys>
+struct perfect_map
+{
+	static_assert(sizeof...(Keys) > 0, "perfect_map: at least one key is required");
+
+	static constexpr auto		 table = perfect_map_logic<Keys...>();
+	static constexpr std::size_t npos  = static_cast<std::size_t>(-1);
+
+	using CharT		 = typename decltype(table)::value_type;
+	using value_type = CharT;
+
+	static_assert(table.duplicate == sizeof...(Keys), "perfect_map: duplicate key");
+	static_assert(table.built || table.duplicate != sizeof...(Keys), "perfect_map: no collision-free seed found");
+
+	static constexpr std::size_t size() { return sizeof...(Keys); }
+
+	// Declaration index of key, or npos
+	static constexpr std::size_t find(std::basic_string_view<CharT> key)
+	{
+		const std::size_t index = table.slots[table.slot_of(phf_hash(key.data(), key.size(), table.seed))];
+		return table.key(index) == key ? index : npos;
+	}
+
+	static constexpr bool contains(std::basic_string_view<CharT> key) { return find(key) != npos; }
+
+	// Declaration index of a key known at compile time; a key outside the set is a compile error
+	template <FixedString Key>
+	static consteval std::size_t index_of()
+	{
+		constexpr std::size_t index = find(std::basic_string_view<CharT>(Key.data, Key.size()));
+		static_assert(index != npos, "perfect_map::index_of: key is not in the map");
+		return index;
+	}
+
+	static constexpr std::basic_string_view<CharT> key(std::size_t index) { return table.key(index); }
+};
+
+}  // namespace ct_str
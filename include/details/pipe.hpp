@@ -0,0 +1,313 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#pragma once
+
+#include "fixed_string.hpp"
+#include "string_fns.hpp"
+#include "string_store.hpp"
+#include <cstddef>
+#include <type_traits>
+
+namespace ct_str
+{
+
+// === PIPELINE TEXT ===
+
+// The working text of a pipeline: a fixed-capacity buffer sized from the stages' growth bounds, so a whole
+// chain runs on one array without allocating.
+template <typename CharT, std::size_t Capacity>
+struct PipeText
+{
+	using value_type = CharT;
+
+	CharT		data[Capacity + 1]{};
+	std::size_t size = 0;
+
+	static constexpr std::size_t capacity() { return Capacity; }
+};
+
+template <typename CharT>
+constexpr bool pipe_is_space(CharT c)
+{
+	return c == CharT{' '} || c == CharT{'\t'} || c == CharT{'\n'} || c == CharT{'\r'};
+}
+
+// Replaces the first Limit non-overlapping occurrences of Pattern, scanning left to right
+template <FixedString Pattern, FixedString Replacement, std::size_t Limit, typename Text>
+constexpr void pipe_replace(Text& text)
+{
+	static_assert(std::is_same_v<typename decltype(Pattern)::value_type, typename Text::value_type> &&
+					  std::is_same_v<typename decltype(Replacement)::value_type, typename Text::value_type>,
+				  "pipe: patterns and replacements must have the same character type as the string");
+	if constexpr (Pattern.size() > 0)
+	{
+		Text		out{};
+		std::size_t pos = 0;
+		for (std::size_t replaced = 0; replaced < Limit; ++replaced)
+		{
+			const std::size_t match = kmp_search<Pattern>(text.data, text.size, pos);
+			if (match == text.size)
+				break;
+			while (pos < match)
+				out.data[out.size++] = text.data[pos++];
+			for (std::size_t j = 0; j < Replacement.size(); ++j)
+				out.data[out.size++] = Replacement[j];
+			pos += Pattern.size();
+		}
+		while (pos < text.size)
+			out.data[out.size++] = text.data[pos++];
+		text = out;
+	}
+}
+
+// Longest result of replacing up to Limit occurrences of Pattern in a string of n characters
+template <auto Pattern, auto Replacement, std::size_t Limit>
+constexpr std::size_t pipe_replace_capacity(std::size_t n)
+{
+	if (Pattern.size() == 0 || Replacement.size() <= Pattern.size())
+		return n;
+	const std::size_t count = n / Pattern.size() < Limit ? n / Pattern.size() : Limit;
+	return n + count * (Replacement.size() - Pattern.size());
+}
+
+// === PIPELINE STAGES ===
+
+// Each stage rewrites the working text in place with the same semantics as the transformation of the same
+// name in string_fns.hpp. A stage is any type with a static apply(Text&), where Text has data, size and
+// value_type; a stage that can lengthen the text also declares static capacity(n), the longest result for
+// n input characters.
+namespace op
+{
+
+struct trim_left
+{
+	template <typename Text>
+	static constexpr void apply(Text& text)
+	{
+		std::size_t start = 0;
+		while (start < text.size && pipe_is_space(text.data[start]))
+			++start;
+		for (std::size_t i = start; i < text.size; ++i)
+			text.data[i - start] = text.data[i];
+		text.size -= start;
+	}
+};
+
+struct trim_right
+{
+	template <typename Text>
+	static constexpr void apply(Text& text)
+	{
+		while (text.size > 0 && pipe_is_space(text.data[text.size - 1]))
+			--text.size;
+	}
+};
+
+struct trim
+{
+	template <typename Text>
+	static constexpr void apply(Text& text)
+	{
+		trim_right::apply(text);
+		trim_left::apply(text);
+	}
+};
+
+struct to_upper
+{
+	template <typename Text>
+	static constexpr void apply(Text& text)
+	{
+		using CharT = typename Text::value_type;
+		for (std::size_t i = 0; i < text.size; ++i)
+		{
+			const CharT c = text.data[i];
+			text.data[i]  = (c >= CharT{'a'} && c <= CharT{'z'}) ? static_cast<CharT>(c - 32) : c;
+		}
+	}
+};
+
+struct to_lower
+{
+	template <typename Text>
+	static constexpr void apply(Text& text)
+	{
+		using CharT = typename Text::value_type;
+		for (std::size_t i = 0; i < text.size; ++i)
+		{
+			const CharT c = text.data[i];
+			text.data[i]  = (c >= CharT{'A'} && c <= CharT{'Z'}) ? static_cast<CharT>(c + 32) : c;
+		}
+	}
+};
+
+struct reverse
+{
+	template <typename Text>
+	static constexpr void apply(Text& text)
+	{
+		for (std::size_t i = 0, j = text.size; i + 1 < j; ++i, --j)
+		{
+			const auto c	 = text.data[i];
+			text.data[i]	 = text.data[j - 1];
+			text.data[j - 1] = c;
+		}
+	}
+};
+
+template <std::size_t Start, std::size_t Length>
+struct substr
+{
+	template <typename Text>
+	static constexpr void apply(Text& text)
+	{
+		const std::size_t start = Start < text.size ? Start : text.size;
+		const std::size_t len	= Length < text.size - start ? Length : text.size - start;
+		for (std::size_t i = 0; i < len; ++i)
+			text.data[i] = text.data[start + i];
+		text.size = len;
+	}
+};
+
+template <std::size_t NChars>
+struct left
+{
+	template <typename Text>
+	static constexpr void apply(Text& text)
+	{
+		if (NChars < text.size)
+			text.size = NChars;
+	}
+};
+
+template <std::size_t NChars>
+struct right
+{
+	template <typename Text>
+	static constexpr void apply(Text& text)
+	{
+		if (NChars < text.size)
+		{
+			const std::size_t start = text.size - NChars;
+			for (std::size_t i = 0; i < NChars; ++i)
+				text.data[i] = text.data[start + i];
+			text.size = NChars;
+		}
+	}
+};
+
+template <FixedString... Strs>
+struct append
+{
+	static constexpr std::size_t capacity(std::size_t n) { return n + (Strs.size() + ... + 0); }
+
+	template <typename Text>
+	static constexpr void apply(Text& text)
+	{
+		static_assert((std::is_same_v<typename decltype(Strs)::value_type, typename Text::value_type> && ...),
+					  "pipe: appended strings must have the same character type as the string");
+		auto append_one = [&text](const auto& str)
+		{
+			for (std::size_t j = 0; j < str.size(); ++j)
+				text.data[text.size++] = str[j];
+		};
+		(append_one(Strs), ...);
+	}
+};
+
+template <FixedString Pattern, FixedString Replacement>
+struct replace
+{
+	static constexpr std::size_t capacity(std::size_t n) { return pipe_replace_capacity<Pattern, Replacement, 1>(n); }
+
+	template <typename Text>
+	static constexpr void apply(Text& text)
+	{
+		pipe_replace<Pattern, Replacement, 1>(text);
+	}
+};
+
+template <FixedString Pattern, FixedString Replacement>
+struct replace_all
+{
+	static constexpr std::size_t capacity(std::size_t n)
+	{
+		return pipe_replace_capacity<Pattern, Replacement, static_cast<std::size_t>(-1)>(n);
+	}
+
+	template <typename Text>
+	static constexpr void apply(Text& text)
+	{
+		pipe_replace<Pattern, Replacement, static_cast<std::size_t>(-1)>(text);
+	}
+};
+
+template <FixedString Pattern, FixedString Replacement, std::size_t N>
+struct replace_n
+{
+	static constexpr std::size_t capacity(std::size_t n) { return pipe_replace_capacity<Pattern, Replacement, N>(n); }
+
+	template <typename Text>
+	static constexpr void apply(Text& text)
+	{
+		pipe_replace<Pattern, Replacement, N>(text);
+	}
+};
+
+}  // namespace op
+
+// === PIPELINE ===
+
+template <typename Op>
+constexpr std::size_t pipe_stage_capacity(std::size_t n)
+{
+	if constexpr (requires { Op::capacity(n); })
+		return Op::capacity(n);
+	else
+		return n;
+}
+
+// Largest working text any stage can produce
+template <typename... Ops>
+constexpr std::size_t pipe_capacity(std::size_t n)
+{
+	std::size_t most = n;
+	((n = pipe_stage_capacity<Ops>(n), most = n > most ? n : most), ...);
+	return most;
+}
+
+template <FixedString Str, typename... Ops>
+consteval auto pipe_run()
+{
+	using CharT = typename decltype(Str)::value_type;
+	PipeText<CharT, pipe_capacity<Ops...>(Str.size())> text{};
+	for (std::size_t i = 0; i < Str.size(); ++i)
+		text.data[i] = Str[i];
+	text.size = Str.size();
+	(Ops::apply(text), ...);
+	return text;
+}
+
+// Runs every stage on one buffer in a single constant evaluation, then copies out the result
+template <FixedString Str, typename... Ops>
+consteval auto pipe_logic()
+{
+	using CharT				  = typename decltype(Str)::value_type;
+	constexpr auto		  text = pipe_run<Str, Ops...>();
+	constexpr std::size_t len  = text.size;
+	return FixedString<CharT, len + 1>(text.data, len);
+}
+
+// Applies a chain of transformations inside a single constant evaluation and instantiates only the final
+// StringStore, where the nested form instantiates one per step:
+//
+//	namespace op = ct_str::op;
+//	using Key	 = ct_str::pipe<"  db-host  ", op::trim, op::to_upper, op::replace_all<"-", "_">>;
+//	// Key::view() == "DB_HOST"
+template <FixedString Str, typename... Ops>
+using pipe = StringStore<pipe_logic<Str, Ops...>()>;
+
+}  // namespace ct_str
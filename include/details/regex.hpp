@@ -0,0 +1,941 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#pragma once
+
+#include "fixed_string.hpp"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ct_str
+{
+
+// Everything up to the DFA table runs only in consteval code; the std::vector allocations are transient and
+// never reach the binary.
+
+enum class RegexError
+{
+	none,
+	unbalanced_parens,
+	nothing_to_repeat,
+	bad_repeat,
+	bad_class,
+	bad_escape,
+	misplaced_anchor,
+	too_many_states,
+};
+
+inline constexpr int		 regex_max_repeat	  = 1000;
+inline constexpr std::size_t regex_max_nfa_states = 20000;
+inline constexpr std::size_t regex_max_dfa_states = 4096;
+
+// === PARSER ===
+
+struct RegexByteSet
+{
+	uint64_t bits[4]{};
+
+	constexpr void set(uint8_t c) { bits[c >> 6] |= uint64_t{1} << (c & 63); }
+	constexpr bool test(uint8_t c) const { return (bits[c >> 6] >> (c & 63)) & 1; }
+
+	constexpr void set_range(uint8_t lo, uint8_t hi)
+	{
+		for (unsigned c = lo; c <= hi; ++c)
+			set(static_cast<uint8_t>(c));
+	}
+
+	constexpr void merge(const RegexByteSet& other)
+	{
+		for (int i = 0; i < 4; ++i)
+			bits[i] |= other.bits[i];
+	}
+
+	constexpr void invert()
+	{
+		for (int i = 0; i < 4; ++i)
+			bits[i] = ~bits[i];
+	}
+};
+
+// \d, \w and \s
+constexpr bool regex_named_class(uint8_t c, RegexByteSet& set)
+{
+	switch (c)
+	{
+	case 'd': set.set_range('0', '9'); return true;
+	case 'w':
+		set.set_range('a', 'z');
+		set.set_range('A', 'Z');
+		set.set_range('0', '9');
+		set.set('_');
+		return true;
+	case 's':
+		set.set(' ');
+		set.set_range('\t', '\r');
+		return true;
+	default: return false;
+	}
+}
+
+struct RegexNode
+{
+	enum Kind
+	{
+		empty,
+		set,
+		concat,
+		alt,
+		repeat,
+	};
+
+	Kind kind  = empty;
+	int	 left  = -1;  // concat and alt operands; repeat operand
+	int	 right = -1;
+	int	 index = -1;  // byte set of a set node
+	int	 min   = 0;	  // repeat bounds; max < 0 is unbounded
+	int	 max   = 0;
+};
+
+// Recursive descent over the ECMAScript subset the DFA can express: literals, escapes (\d \w \s and their
+// negations, \n \t \r \f \v \0 \xHH, escaped punctuation), '.', bracket classes with ranges and negation,
+// groups ((...) and (?:...), neither capturing), '|', and the quantifiers * + ? {n} {n,} {n,m}. '^' and '$' are
+// accepted only as the first and last character of a pattern without a top-level '|'.
+template <typename CharT>
+struct RegexParser
+{
+	const CharT*			  str;
+	std::size_t				  len;
+	std::size_t				  pos			 = 0;
+	bool					  anchored_begin = false;
+	bool					  anchored_end	 = false;
+	RegexError				  error			 = RegexError::none;
+	std::vector<RegexNode>	  nodes;
+	std::vector<RegexByteSet> sets;
+
+	constexpr RegexParser(const CharT* s, std::size_t n) : str(s), len(n) {}
+
+	constexpr bool	  at_end() const { return pos >= len; }
+	constexpr uint8_t peek() const { return static_cast<uint8_t>(str[pos]); }
+	constexpr uint8_t next() { return static_cast<uint8_t>(str[pos++]); }
+
+	constexpr int fail(RegexError e)
+	{
+		if (error == RegexError::none)
+			error = e;
+		return -1;
+	}
+
+	constexpr int add_node(RegexNode node)
+	{
+		nodes.push_back(node);
+		return static_cast<int>(nodes.size() - 1);
+	}
+
+	constexpr int add_set(const RegexByteSet& set)
+	{
+		sets.push_back(set);
+		RegexNode node{};
+		node.kind  = RegexNode::set;
+		node.index = static_cast<int>(sets.size() - 1);
+		return add_node(node);
+	}
+
+	constexpr int parse()
+	{
+		if (len > 0 && str[0] == '^')
+		{
+			anchored_begin = true;
+			pos			   = 1;
+		}
+		if (len > pos && str[len - 1] == '$')
+		{
+			// An escaped '$' is a literal: count the backslashes in front of it
+			std::size_t slashes = 0;
+			while (len - 1 - slashes > pos && str[len - 2 - slashes] == '\\')
+				++slashes;
+			if (slashes % 2 == 0)
+			{
+				anchored_end = true;
+				--len;
+			}
+		}
+		const int root = parse_alt(0);
+		if (error == RegexError::none && !at_end())
+			return fail(RegexError::unbalanced_parens);
+		return root;
+	}
+
+	constexpr int parse_alt(int depth)
+	{
+		int left = parse_concat();
+		while (error == RegexError::none && !at_end() && peek() == '|')
+		{
+			if (depth == 0 && (anchored_begin || anchored_end))
+				return fail(RegexError::misplaced_anchor);
+			++pos;
+			const int right = parse_concat();
+			RegexNode node{};
+			node.kind  = RegexNode::alt;
+			node.left  = left;
+			node.right = right;
+			left	   = add_node(node);
+		}
+		return left;
+	}
+
+	constexpr int parse_concat()
+	{
+		int result = -1;
+		while (error == RegexError::none && !at_end() && peek() != '|' && peek() != ')')
+		{
+			const int item = parse_repeat();
+			if (result < 0)
+				result = item;
+			else
+			{
+				RegexNode node{};
+				node.kind  = RegexNode::concat;
+				node.left  = result;
+				node.right = item;
+				result	   = add_node(node);
+			}
+		}
+		return result < 0 ? add_node(RegexNode{}) : result;
+	}
+
+	constexpr bool parse_number(int& value)
+	{
+		if (at_end() || peek() < '0' || peek() > '9')
+			return false;
+		value = 0;
+		while (!at_end() && peek() >= '0' && peek() <= '9')
+		{
+			value = value * 10 + (next() - '0');
+			if (value > regex_max_repeat)
+				return false;
+		}
+		return true;
+	}
+
+	constexpr int parse_repeat()
+	{
+		const int atom = parse_atom();
+		if (error != RegexError::none || at_end())
+			return atom;
+
+		int min = 0, max = 0;
+		switch (peek())
+		{
+		case '*': min = 0, max = -1; break;
+		case '+': min = 1, max = -1; break;
+		case '?': min = 0, max = 1; break;
+		case '{':
+			++pos;
+			if (!parse_number(min))
+				return fail(RegexError::bad_repeat);
+			max = min;
+			if (!at_end() && peek() == ',')
+			{
+				++pos;
+				max = -1;
+				if (!at_end() && peek() != '}' && !parse_number(max))
+					return fail(RegexError::bad_repeat);
+			}
+			if (at_end() || peek() != '}' || (max >= 0 && max < min))
+				return fail(RegexError::bad_repeat);
+			break;
+		default: return atom;
+		}
+		++pos;
+
+		// A lazy quantifier accepts the same strings as a greedy one; a second quantifier is an error, as in
+		// ECMAScript
+		if (!at_end() && peek() == '?')
+			++pos;
+		if (!at_end() && (peek() == '*' || peek() == '+' || peek() == '?' || peek() == '{'))
+			return fail(RegexError::nothing_to_repeat);
+
+		RegexNode node{};
+		node.kind = RegexNode::repeat;
+		node.left = atom;
+		node.min  = min;
+		node.max  = max;
+		return add_node(node);
+	}
+
+	constexpr int parse_atom()
+	{
+		const uint8_t c = next();
+		RegexByteSet  set{};
+		switch (c)
+		{
+		case '(':
+		{
+			if (len - pos >= 2 && str[pos] == '?' && str[pos + 1] == ':')
+				pos += 2;
+			const int inner = parse_alt(1);
+			if (error != RegexError::none)
+				return -1;
+			if (at_end() || next() != ')')
+				return fail(RegexError::unbalanced_parens);
+			return inner;
+		}
+		case '[': return parse_class();
+		case '.':
+			set.set('\n');
+			set.set('\r');
+			set.invert();
+			return add_set(set);
+		case '\\':
+		{
+			bool single = false;
+			if (!parse_escape(set, single))
+				return fail(RegexError::bad_escape);
+			return add_set(set);
+		}
+		case '*':
+		case '+':
+		case '?':
+		case '{': return fail(RegexError::nothing_to_repeat);
+		case '^':
+		case '$': return fail(RegexError::misplaced_anchor);
+		default: set.set(c); return add_set(set);
+		}
+	}
+
+	// Parses the escape after a backslash into set; single reports a one-byte escape usable in a range
+	constexpr bool parse_escape(RegexByteSet& set, bool& single)
+	{
+		if (at_end())
+			return false;
+		const uint8_t c = next();
+		single			= false;
+		if (regex_named_class(c, set))
+			return true;
+		if (c == 'D' || c == 'W' || c == 'S')
+		{
+			regex_named_class(static_cast<uint8_t>(c + ('a' - 'A')), set);
+			set.invert();
+			return true;
+		}
+
+		single = true;
+		switch (c)
+		{
+		case 'n': set.set('\n'); return true;
+		case 't': set.set('\t'); return true;
+		case 'r': set.set('\r'); return true;
+		case 'f': set.set('\f'); return true;
+		case 'v': set.set('\v'); return true;
+		case '0': set.set(0); return true;
+		case 'x':
+		{
+			int value = 0;
+			for (int i = 0; i < 2; ++i)
+			{
+				if (at_end())
+					return false;
+				const uint8_t h = next();
+				if (h >= '0' && h <= '9')
+					value = value * 16 + (h - '0');
+				else if ((h | 0x20) >= 'a' && (h | 0x20) <= 'f')
+					value = value * 16 + ((h | 0x20) - 'a' + 10);
+				else
+					return false;
+			}
+			set.set(static_cast<uint8_t>(value));
+			return true;
+		}
+		default:
+			// Only punctuation escapes to itself; unknown letter escapes (\b, \q, ...) are errors
+			if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9'))
+				return false;
+			set.set(c);
+			return true;
+		}
+	}
+
+	// One class member: a byte (lo, with single true) or a multi-byte escape such as \d merged into set
+	constexpr bool parse_class_item(RegexByteSet& set, uint8_t& lo, bool& single)
+	{
+		const uint8_t c = next();
+		if (c != '\\')
+		{
+			lo	   = c;
+			single = true;
+			return true;
+		}
+		RegexByteSet escaped{};
+		if (!parse_escape(escaped, single))
+			return false;
+		if (single)
+		{
+			for (unsigned b = 0; b < 256; ++b)
+			{
+				if (escaped.test(static_cast<uint8_t>(b)))
+					lo = static_cast<uint8_t>(b);
+			}
+		}
+		else
+			set.merge(escaped);
+		return true;
+	}
+
+	constexpr int parse_class()
+	{
+		RegexByteSet set{};
+		bool		 negate = !at_end() && peek() == '^';
+		if (negate)
+			++pos;
+		for (;;)
+		{
+			if (at_end())
+				return fail(RegexError::bad_class);
+			if (peek() == ']')
+			{
+				++pos;
+				break;
+			}
+			uint8_t lo = 0;
+			bool	single = false;
+			if (!parse_class_item(set, lo, single))
+				return fail(RegexError::bad_escape);
+			if (!single)
+				continue;
+			if (len - pos >= 2 && peek() == '-' && str[pos + 1] != ']')
+			{
+				++pos;
+				uint8_t hi = 0;
+				if (!parse_class_item(set, hi, single))
+					return fail(RegexError::bad_escape);
+				if (!single || hi < lo)
+					return fail(RegexError::bad_class);
+				set.set_range(lo, hi);
+			}
+			else
+				set.set(lo);
+		}
+		if (negate)
+			set.invert();
+		return add_set(set);
+	}
+};
+
+// === NFA ===
+
+// Thompson construction. A state with a byte set consumes one byte in it and moves to out1; any other state
+// moves to out1 and out2 (when set) without consuming input.
+struct RegexNfaState
+{
+	int set	 = -1;
+	int out1 = -1;
+	int out2 = -1;
+};
+
+struct RegexNfa
+{
+	std::vector<RegexNfaState> states;
+	const std::vector<RegexNode>* nodes = nullptr;
+	bool						  overflow = false;
+
+	constexpr int add(RegexNfaState state = {})
+	{
+		states.push_back(state);
+		if (states.size() > regex_max_nfa_states)
+			overflow = true;
+		return static_cast<int>(states.size() - 1);
+	}
+
+	// Emits node and returns its entry state and its exit state, whose out1 is left open
+	constexpr std::pair<int, int> emit(int index)
+	{
+		if (overflow)
+			return {add(), add()};
+		const RegexNode node = (*nodes)[index];
+		switch (node.kind)
+		{
+		case RegexNode::empty:
+		{
+			const int e = add();
+			return {e, e};
+		}
+		case RegexNode::set:
+		{
+			const int e = add();
+			const int s = add({node.index, e, -1});
+			return {s, e};
+		}
+		case RegexNode::concat:
+		{
+			const auto a	   = emit(node.left);
+			const auto b	   = emit(node.right);
+			states[a.second].out1 = b.first;
+			return {a.first, b.second};
+		}
+		case RegexNode::alt:
+		{
+			const auto a		  = emit(node.left);
+			const auto b		  = emit(node.right);
+			const int  e		  = add();
+			const int  s		  = add({-1, a.first, b.first});
+			states[a.second].out1 = e;
+			states[b.second].out1 = e;
+			return {s, e};
+		}
+		case RegexNode::repeat:
+		{
+			const int start = add();
+			int		  cur	= start;
+			for (int i = 0; i < node.min && !overflow; ++i)
+			{
+				const auto a	  = emit(node.left);
+				states[cur].out1 = a.first;
+				cur				  = a.second;
+			}
+			const int end = add();
+			if (node.max < 0)
+			{
+				const auto a		  = emit(node.left);
+				const int  loop		  = add({-1, a.first, end});
+				states[cur].out1	  = loop;
+				states[a.second].out1 = loop;
+				return {start, end};
+			}
+			for (int i = node.min; i < node.max && !overflow; ++i)
+			{
+				const auto a	  = emit(node.left);
+				const int  split = add({-1, a.first, end});
+				states[cur].out1 = split;
+				cur				  = a.second;
+			}
+			states[cur].out1 = end;
+			return {start, end};
+		}
+		}
+		return {add(), add()};
+	}
+};
+
+// === DFA ===
+
+struct RegexDfa
+{
+	RegexError			 error = RegexError::none;
+	uint8_t				 byte_class[256]{};
+	std::size_t			 classes = 0;
+	std::size_t			 states	 = 0;
+	std::vector<int>	 next;	// states * classes; state 0 is dead, accepting states are numbered last
+	std::size_t			 first_accept = 0;
+	int					 start		  = 0;
+	bool				 stop_on_accept = false;
+};
+
+// Parses pattern, builds the NFA, and determinizes it over byte classes. In search mode an unanchored pattern
+// may start at any position, and without a trailing '$' accepting states absorb, so the first accepting state
+// reached decides the search. Hopcroft's partition refinement then minimizes the DFA.
+template <typename CharT>
+constexpr RegexDfa regex_compile(const CharT* pattern, std::size_t length, bool search)
+{
+	RegexDfa			dfa{};
+	RegexParser<CharT>	parser(pattern, length);
+	const int			root = parser.parse();
+	if (parser.error != RegexError::none)
+	{
+		dfa.error = parser.error;
+		return dfa;
+	}
+
+	RegexNfa nfa{};
+	nfa.nodes			  = &parser.nodes;
+	const auto [s, e]	  = nfa.emit(root);
+	const int  accept	  = nfa.add();
+	nfa.states[e].out1	  = accept;
+	if (nfa.overflow)
+	{
+		dfa.error = RegexError::too_many_states;
+		return dfa;
+	}
+
+	// Byte classes: refine one partition of 0..255 by every set in the pattern
+	{
+		int classes = 1;
+		for (const RegexByteSet& set : parser.sets)
+		{
+			int split[512];
+			for (int i = 0; i < 512; ++i)
+				split[i] = -1;
+			int next_class = 0;
+			for (unsigned b = 0; b < 256; ++b)
+			{
+				const int key = dfa.byte_class[b] * 2 + (set.test(static_cast<uint8_t>(b)) ? 1 : 0);
+				if (split[key] < 0)
+					split[key] = next_class++;
+				dfa.byte_class[b] = static_cast<uint8_t>(split[key]);
+			}
+			classes = next_class;
+		}
+		dfa.classes = static_cast<std::size_t>(classes);
+	}
+	const std::size_t k = dfa.classes;
+	uint8_t			  representative[256]{};
+	for (unsigned b = 256; b-- > 0;)
+		representative[dfa.byte_class[b]] = static_cast<uint8_t>(b);
+
+	// Subset construction; DFA states are bitsets over NFA states, found again through a small hash table
+	const std::size_t	  n		= nfa.states.size();
+	const std::size_t	  words = (n + 63) / 64;
+	std::vector<uint64_t> subsets;
+	std::vector<int>	  hash_head(1024, -1);
+	std::vector<int>	  hash_next;
+	std::vector<int>	  stack;
+	std::vector<int>	  trans;
+
+	auto closure = [&](std::vector<uint64_t>& bits)
+	{
+		stack.clear();
+		for (std::size_t w = 0; w < words; ++w)
+		{
+			for (uint64_t x = bits[w]; x != 0; x &= x - 1)
+				stack.push_back(static_cast<int>(w * 64 + std::countr_zero(x)));
+		}
+		while (!stack.empty())
+		{
+			const int i = stack.back();
+			stack.pop_back();
+			if (nfa.states[i].set >= 0)
+				continue;
+			for (const int to : {nfa.states[i].out1, nfa.states[i].out2})
+			{
+				if (to >= 0 && !((bits[to / 64] >> (to % 64)) & 1))
+				{
+					bits[to / 64] |= uint64_t{1} << (to % 64);
+					stack.push_back(to);
+				}
+			}
+		}
+	};
+	auto hash_of = [&](const std::vector<uint64_t>& bits)
+	{
+		uint64_t h = 0;
+		for (std::size_t w = 0; w < words; ++w)
+			h = (h ^ bits[w]) * 0x9e3779b97f4a7c15ULL;
+		return static_cast<std::size_t>(h >> 54);
+	};
+	auto intern = [&](const std::vector<uint64_t>& bits)
+	{
+		const std::size_t h = hash_of(bits);
+		for (int d = hash_head[h]; d >= 0; d = hash_next[d])
+		{
+			bool same = true;
+			for (std::size_t w = 0; w < words && same; ++w)
+				same = subsets[d * words + w] == bits[w];
+			if (same)
+				return d;
+		}
+		const int d = static_cast<int>(subsets.size() / words);
+		if (static_cast<std::size_t>(d) >= regex_max_dfa_states)
+			return -1;
+		subsets.insert(subsets.end(), bits.begin(), bits.end());
+		hash_next.push_back(hash_head[h]);
+		hash_head[h] = d;
+		return d;
+	};
+
+	std::vector<uint64_t> start_bits(words, 0);
+	start_bits[s / 64] |= uint64_t{1} << (s % 64);
+	closure(start_bits);
+	const bool restart = search && !parser.anchored_begin;
+
+	std::vector<uint64_t> bits(words, 0);
+	intern(bits);  // dead state
+	const int start = intern(start_bits);
+	dfa.stop_on_accept = search && !parser.anchored_end;
+
+	for (std::size_t d = 0; d < subsets.size() / words; ++d)
+	{
+		const bool accepting = (subsets[d * words + accept / 64] >> (accept % 64)) & 1;
+		for (std::size_t c = 0; c < k; ++c)
+		{
+			if (accepting && dfa.stop_on_accept)
+			{
+				trans.push_back(static_cast<int>(d));
+				continue;
+			}
+			for (std::size_t w = 0; w < words; ++w)
+				bits[w] = restart && d != 0 ? start_bits[w] : 0;
+			for (std::size_t w = 0; w < words; ++w)
+			{
+				for (uint64_t x = subsets[d * words + w]; x != 0; x &= x - 1)
+				{
+					const int i = static_cast<int>(w * 64 + std::countr_zero(x));
+					if (nfa.states[i].set >= 0 && parser.sets[nfa.states[i].set].test(representative[c]))
+					{
+						const int to = nfa.states[i].out1;
+						bits[to / 64] |= uint64_t{1} << (to % 64);
+					}
+				}
+			}
+			closure(bits);
+			const int to = intern(bits);
+			if (to < 0)
+			{
+				dfa.error = RegexError::too_many_states;
+				return dfa;
+			}
+			trans.push_back(to);
+		}
+	}
+	const std::size_t count = subsets.size() / words;
+
+	// Hopcroft minimization: start from accepting / non-accepting, and split blocks by the predecessors of a
+	// splitter block on one class, queueing only the smaller half of each split. Live states that can never accept
+	// end up in the dead state's block.
+	auto accepting = [&](std::size_t d) { return ((subsets[d * words + accept / 64] >> (accept % 64)) & 1) != 0; };
+
+	// Predecessors of each state on each class, grouped by (state, class)
+	std::vector<std::size_t> pred_start(count * k + 1, 0);
+	std::vector<std::size_t> preds(count * k);
+	for (std::size_t i = 0; i < count * k; ++i)
+		++pred_start[static_cast<std::size_t>(trans[i]) * k + i % k + 1];
+	for (std::size_t i = 0; i < count * k; ++i)
+		pred_start[i + 1] += pred_start[i];
+	{
+		std::vector<std::size_t> fill(pred_start.begin(), pred_start.end() - 1);
+		for (std::size_t i = 0; i < count * k; ++i)
+			preds[fill[static_cast<std::size_t>(trans[i]) * k + i % k]++] = i / k;
+	}
+
+	// Each block is a range of elems; while a splitter is applied, a block's marked states are moved to its front
+	std::vector<std::size_t> elems(count);
+	std::vector<std::size_t> where(count);
+	std::vector<std::size_t> block(count);
+	std::vector<std::size_t> first;
+	std::vector<std::size_t> size;
+	std::vector<std::size_t> marked;
+	std::size_t				 blocks = 0;
+	for (std::size_t pos = 0, pass = 0; pass < 2; ++pass)
+	{
+		const std::size_t begin = pos;
+		for (std::size_t d = 0; d < count; ++d)
+		{
+			if (accepting(d) == (pass == 1))
+			{
+				elems[pos] = d;
+				where[d]   = pos++;
+				block[d]   = blocks;
+			}
+		}
+		if (pos > begin)
+		{
+			first.push_back(begin);
+			size.push_back(pos - begin);
+			marked.push_back(0);
+			++blocks;
+		}
+	}
+
+	std::vector<std::size_t> work;	// block * k + class
+	std::vector<uint8_t>	 queued(blocks * k, 1);
+	for (std::size_t i = 0; i < blocks * k; ++i)
+		work.push_back(i);
+	std::vector<std::size_t> splitter;
+	std::vector<std::size_t> touched;
+	while (!work.empty())
+	{
+		const std::size_t item = work.back();
+		work.pop_back();
+		queued[item]		= 0;
+		const std::size_t b = item / k;
+		const std::size_t c = item % k;
+
+		splitter.clear();
+		for (std::size_t i = first[b]; i < first[b] + size[b]; ++i)
+		{
+			const std::size_t to = elems[i] * k + c;
+			splitter.insert(splitter.end(), preds.begin() + pred_start[to], preds.begin() + pred_start[to + 1]);
+		}
+		touched.clear();
+		for (const std::size_t d : splitter)
+		{
+			const std::size_t y		= block[d];
+			const std::size_t front = first[y] + marked[y];
+			if (where[d] < front)
+				continue;  // already marked
+			if (marked[y]++ == 0)
+				touched.push_back(y);
+			const std::size_t other = elems[front];
+			elems[where[d]]			= other;
+			where[other]			= where[d];
+			elems[front]			= d;
+			where[d]				= front;
+		}
+		for (const std::size_t y : touched)
+		{
+			if (marked[y] == size[y])
+			{
+				marked[y] = 0;
+				continue;
+			}
+			// The marked front of y becomes block z
+			const std::size_t z = blocks++;
+			first.push_back(first[y]);
+			size.push_back(marked[y]);
+			marked.push_back(0);
+			first[y] += marked[y];
+			size[y] -= marked[y];
+			marked[y] = 0;
+			for (std::size_t i = first[z]; i < first[z] + size[z]; ++i)
+				block[elems[i]] = z;
+			queued.resize(blocks * k, 0);
+			for (std::size_t x = 0; x < k; ++x)
+			{
+				const std::size_t half = queued[y * k + x] != 0 || size[z] <= size[y] ? z : y;
+				if (queued[half * k + x] == 0)
+				{
+					queued[half * k + x] = 1;
+					work.push_back(half * k + x);
+				}
+			}
+		}
+	}
+	std::vector<std::size_t> reps(blocks);
+	for (std::size_t r = 0; r < blocks; ++r)
+		reps[r] = elems[first[r]];
+
+	// Number blocks: dead first, accepting last
+	std::vector<int> number(blocks, -1);
+	int				 next_number = 0;
+	number[block[0]]			 = next_number++;
+	for (int pass = 0; pass < 2; ++pass)
+	{
+		for (std::size_t r = 0; r < blocks; ++r)
+		{
+			if (number[r] < 0 && accepting(reps[r]) == (pass == 1))
+			{
+				if (pass == 1 && dfa.first_accept == 0)
+					dfa.first_accept = static_cast<std::size_t>(next_number);
+				number[r] = next_number++;
+			}
+		}
+	}
+	if (dfa.first_accept == 0)
+		dfa.first_accept = blocks;
+
+	dfa.states = blocks;
+	dfa.start  = number[block[start]];
+	dfa.next.assign(blocks * k, 0);
+	for (std::size_t r = 0; r < blocks; ++r)
+	{
+		for (std::size_t c = 0; c < k; ++c)
+			dfa.next[number[r] * k + c] = number[block[trans[reps[r] * k + c]]];
+	}
+	return dfa;
+}
+
+// === MATCHER ===
+
+// States are stored premultiplied by the class count, so a step is one table read at state + class. State 0
+// is the dead state; states from first_accept on are accepting.
+template <typename CharT, std::size_t States, std::size_t Classes>
+struct RegexTable
+{
+	using value_type = CharT;
+	using state_type = std::conditional_t<(States * Classes < 0x10000), uint16_t, uint32_t>;
+
+	uint8_t	   byte_class[256]{};
+	state_type next[States * Classes]{};
+	state_type start		  = 0;
+	state_type first_accept	  = 0;
+	bool	   stop_on_accept = false;
+
+	constexpr bool run(std::basic_string_view<CharT> text) const
+	{
+		state_type s = start;
+		for (const CharT c : text)
+		{
+			if (stop_on_accept && s >= first_accept)
+				return true;
+			s = next[s + byte_class[static_cast<uint8_t>(c)]];
+			if (s == 0)
+				return false;
+		}
+		return s >= first_accept;
+	}
+};
+
+struct RegexShape
+{
+	RegexError	error	= RegexError::none;
+	std::size_t states	= 0;
+	std::size_t classes = 0;
+};
+
+template <FixedString Pattern, bool Search>
+consteval RegexShape regex_shape()
+{
+	const RegexDfa dfa = regex_compile(Pattern.data, Pattern.size(), Search);
+	return {dfa.error, dfa.states, dfa.classes};
+}
+
+template <FixedString Pattern, bool Search>
+consteval auto regex_logic()
+{
+	using CharT = typename decltype(Pattern)::value_type;
+	static_assert(sizeof(CharT) == 1, "regex: patterns must use a byte-sized character type");
+
+	constexpr RegexShape shape = regex_shape<Pattern, Search>();
+	static_assert(shape.error != RegexError::unbalanced_parens, "regex: unbalanced parentheses");
+	static_assert(shape.error != RegexError::nothing_to_repeat, "regex: quantifier with nothing to repeat");
+	static_assert(shape.error != RegexError::bad_repeat, "regex: malformed {n,m} repetition or count over 1000");
+	static_assert(shape.error != RegexError::bad_class, "regex: malformed character class");
+	static_assert(shape.error != RegexError::bad_escape, "regex: unsupported escape sequence");
+	static_assert(shape.error != RegexError::misplaced_anchor,
+				  "regex: '^' and '$' are only supported at the ends of a pattern without a top-level '|'");
+	static_assert(shape.error != RegexError::too_many_states, "regex: automaton too large");
+
+	using Table		 = RegexTable<CharT, shape.states, shape.classes>;
+	using state_type = typename Table::state_type;
+	Table table{};
+
+	const RegexDfa dfa = regex_compile(Pattern.data, Pattern.size(), Search);
+	for (int b = 0; b < 256; ++b)
+		table.byte_class[b] = dfa.byte_class[b];
+	for (std::size_t i = 0; i < shape.states * shape.classes; ++i)
+		table.next[i] = static_cast<state_type>(dfa.next[i] * shape.classes);
+	table.start			 = static_cast<state_type>(dfa.start * shape.classes);
+	table.first_accept	 = static_cast<state_type>(dfa.first_accept * shape.classes);
+	table.stop_on_accept = dfa.stop_on_accept;
+	return table;
+}
+
+// === REGEX ===
+
+// Regular expression compiled at compile time to a minimal DFA over byte classes. match() tests the whole
+// string, search() whether any substring matches; both are a single table-driven pass with no backtracking
+// and no allocation. Patterns use the ECMAScript subset described at RegexParser; syntax errors are compile
+// errors.
+//
+//	using Id = ct_str::regex<"[a-z]+_[0-9]{3}">;
+//	if (!Id::match(field)) return reject();
+template <FixedString Pattern>
+struct regex
+{
+	using CharT		 = typename decltype(Pattern)::value_type;
+	using value_type = CharT;
+
+	// A variable template, so each table is only built when the function that reads it is used
+	template <bool Search>
+	static constexpr auto table = regex_logic<Pattern, Search>();
+
+	static constexpr bool match(std::basic_string_view<CharT> text) { return table<false>.run(text); }
+	static constexpr bool search(std::basic_string_view<CharT> text) { return table<true>.run(text); }
+};
+
+}  // namespace ct_str
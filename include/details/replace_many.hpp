@@ -0,0 +1,126 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#pragma once
+
+#include "aho_corasick.hpp"
+#include "fixed_string.hpp"
+#include "key_pack.hpp"
+#include "string_store.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace ct_str
+{
+
+// One substitution for replace_many: occurrences of From are replaced by To
+template <FixedString From, FixedString To>
+struct pair
+{
+	static constexpr auto from = From;
+	static constexpr auto to   = To;
+};
+
+// === REPLACEMENT PLAN ===
+
+// Which pattern is replaced at each position of the input, and the exact length of the result. match[i] is the
+// index + 1 of the longest pattern starting at i, or 0; a match is only taken if it starts after the previous one.
+template <std::size_t N>
+struct ReplaceManyPlan
+{
+	uint32_t	match[N + 1]{};
+	std::size_t size = 0;
+};
+
+template <FixedString Str, typename... Pairs>
+consteval auto replace_many_plan()
+{
+	using CharT		  = typename decltype(Str)::value_type;
+	using Automaton	  = aho_corasick<Pairs::from...>;
+	constexpr auto& ac = Automaton::table;
+
+	constexpr std::size_t from_len[] = {Pairs::from.size()...};
+	constexpr std::size_t to_len[]	 = {Pairs::to.size()...};
+
+	// One pass of the automaton: it reports every match, and each start position keeps its longest
+	ReplaceManyPlan<Str.size()> plan{};
+	auto longest = [&plan, &from_len](std::size_t pattern, std::size_t offset)
+	{
+		const uint32_t current = plan.match[offset];
+		if (current == 0 || from_len[current - 1] < from_len[pattern])
+			plan.match[offset] = static_cast<uint32_t>(pattern + 1);
+	};
+	ac.scan(std::basic_string_view<CharT>(Str.data, Str.size()), longest);
+
+	// Leftmost first: drop matches that start inside an earlier one, and size the result
+	for (std::size_t i = 0; i < Str.size();)
+	{
+		const uint32_t m = plan.match[i];
+		if (m == 0)
+		{
+			++plan.size;
+			++i;
+			continue;
+		}
+		plan.size += to_len[m - 1];
+		for (std::size_t j = i + 1; j < i + from_len[m - 1]; ++j)
+			plan.match[j] = 0;
+		i += from_len[m - 1];
+	}
+	return plan;
+}
+
+// === REPLACE MANY ===
+
+template <FixedString Str, typename... Pairs>
+consteval auto replace_many_logic()
+{
+	static_assert(sizeof...(Pairs) > 0, "replace_many: at least one pair is required");
+	using CharT = typename decltype(Str)::value_type;
+
+	constexpr bool same_char[] = {(std::is_same_v<typename decltype(Pairs::from)::value_type, CharT> &&
+								   std::is_same_v<typename decltype(Pairs::to)::value_type, CharT>)...};
+	static_assert(key_pack_all(same_char),
+				  "replace_many: patterns and replacements must have the same character type as the string");
+	static_assert(sizeof(CharT) == 1, "replace_many: strings must use a byte-sized character type");
+	constexpr bool non_empty[] = {(Pairs::from.size() > 0)...};
+	static_assert(key_pack_all(non_empty), "replace_many: patterns must not be empty");
+
+	constexpr auto		  plan = replace_many_plan<Str, Pairs...>();
+	constexpr std::size_t len  = plan.size;
+
+	constexpr std::size_t from_len[] = {Pairs::from.size()...};
+	constexpr std::size_t to_len[]	 = {Pairs::to.size()...};
+	const CharT*		  to_data[]	 = {Pairs::to.data...};
+
+	CharT		buf[len + 1]{};
+	std::size_t dst = 0;
+	for (std::size_t i = 0; i < Str.size();)
+	{
+		const uint32_t m = plan.match[i];
+		if (m == 0)
+		{
+			buf[dst++] = Str[i++];
+			continue;
+		}
+		for (std::size_t j = 0; j < to_len[m - 1]; ++j)
+			buf[dst++] = to_data[m - 1][j];
+		i += from_len[m - 1];
+	}
+	return FixedString<CharT, len + 1>(buf, len);
+}
+
+// Applies several substitutions in one left-to-right pass. At each position the longest matching pattern is
+// replaced and scanning resumes after it; replacements are never rescanned, so the order of the pairs does not
+// matter. The patterns share one Aho-Corasick automaton, and the result is sized exactly before it is built:
+//
+//	using Escaped = ct_str::replace_many<"a < b && c", ct_str::pair<"&", "&amp;">, ct_str::pair<"<", "&lt;">>;
+//	// Escaped::view() == "a &lt; b &amp;&amp; c"
+template <FixedString Str, typename... Pairs>
+using replace_many = StringStore<replace_many_logic<Str, Pairs...>()>;
+
+}  // namespace ct_str
@@ -0,0 +1,192 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#pragma once
+
+#include "cpu_features.hpp"
+#include "hash.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace ct_str::rt
+{
+
+// Runtime CRC-32 producing exactly the values of ct_str::crc32<Str>(). All kernels take and return the
+// finalized CRC (start from 0, chain results), like ct_str::crc32_update.
+
+using Crc32Kernel = uint32_t (*)(uint32_t crc, const std::byte* data, std::size_t len);
+
+// === PORTABLE KERNEL: SLICING-BY-16 ===
+
+// Little-endian 32-bit load; compilers merge the byte loads into a single load
+inline uint32_t load_le32(const std::byte* p)
+{
+	return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) | (static_cast<uint32_t>(p[2]) << 16) |
+		   (static_cast<uint32_t>(p[3]) << 24);
+}
+
+inline uint32_t crc32_slicing16(uint32_t crc, const std::byte* data, std::size_t len)
+{
+	const auto& t = crc32_tables.table;
+	crc			  = ~crc;
+	for (; len >= 16; data += 16, len -= 16)
+	{
+		const uint32_t w0 = load_le32(data) ^ crc;
+		const uint32_t w1 = load_le32(data + 4);
+		const uint32_t w2 = load_le32(data + 8);
+		const uint32_t w3 = load_le32(data + 12);
+		crc = t[15][w0 & 0xFF] ^ t[14][(w0 >> 8) & 0xFF] ^ t[13][(w0 >> 16) & 0xFF] ^ t[12][w0 >> 24] ^
+			  t[11][w1 & 0xFF] ^ t[10][(w1 >> 8) & 0xFF] ^ t[9][(w1 >> 16) & 0xFF] ^ t[8][w1 >> 24] ^
+			  t[7][w2 & 0xFF] ^ t[6][(w2 >> 8) & 0xFF] ^ t[5][(w2 >> 16) & 0xFF] ^ t[4][w2 >> 24] ^
+			  t[3][w3 & 0xFF] ^ t[2][(w3 >> 8) & 0xFF] ^ t[1][(w3 >> 16) & 0xFF] ^ t[0][w3 >> 24];
+	}
+	return crc32_update(~crc, data, len);
+}
+
+// === CARRY-LESS MULTIPLY KERNEL ===
+
+#if CT_STR_X86_DISPATCH
+
+// Fold a 128-bit accumulator forward by 128 bits and add the next block
+CT_STR_TARGET("pclmul,sse4.1")
+inline __m128i crc32_fold16(__m128i acc, __m128i next, __m128i k)
+{
+	__m128i lo = _mm_clmulepi64_si128(acc, k, 0x00);
+	__m128i hi = _mm_clmulepi64_si128(acc, k, 0x11);
+	return _mm_xor_si128(_mm_xor_si128(hi, next), lo);
+}
+
+// Folds 64 bytes per step with PCLMULQDQ, then reduces to 32 bits with a Barrett reduction
+// (Gopal et al., "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction").
+// Takes and returns the non-finalized CRC; len must be a multiple of 16 and at least 64.
+CT_STR_TARGET("pclmul,sse4.1")
+inline uint32_t crc32_fold_pclmul(uint32_t crc, const std::byte* buf, std::size_t len)
+{
+	// Bit-reflected folding constants for the IEEE polynomial
+	const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4);
+	const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0);
+	const __m128i k5k0 = _mm_set_epi64x(0, 0x0163cd6124);
+	const __m128i poly = _mm_set_epi64x(0x01f7011641, 0x01db710641);
+
+	auto load = [](const std::byte* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); };
+
+	__m128i x1 = _mm_xor_si128(load(buf), _mm_cvtsi32_si128(static_cast<int>(crc)));
+	__m128i x2 = load(buf + 16);
+	__m128i x3 = load(buf + 32);
+	__m128i x4 = load(buf + 48);
+	buf += 64;
+	len -= 64;
+
+	// Four parallel folds of 64 bytes
+	for (; len >= 64; buf += 64, len -= 64)
+	{
+		__m128i x5 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+		__m128i x6 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+		__m128i x7 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+		__m128i x8 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+
+		x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k1k2, 0x11), x5), load(buf));
+		x2 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x2, k1k2, 0x11), x6), load(buf + 16));
+		x3 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x3, k1k2, 0x11), x7), load(buf + 32));
+		x4 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x4, k1k2, 0x11), x8), load(buf + 48));
+	}
+
+	// Fold the four lanes into one, then fold any remaining 16-byte blocks
+	x1 = crc32_fold16(x1, x2, k3k4);
+	x1 = crc32_fold16(x1, x3, k3k4);
+	x1 = crc32_fold16(x1, x4, k3k4);
+	for (; len >= 16; buf += 16, len -= 16)
+		x1 = crc32_fold16(x1, load(buf), k3k4);
+
+	// Fold 128 bits to 64 bits
+	const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+	x2					 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+	x1					 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+	x2					 = _mm_srli_si128(x1, 4);
+	x1					 = _mm_and_si128(x1, mask32);
+	x1					 = _mm_xor_si128(_mm_clmulepi64_si128(x1, k5k0, 0x00), x2);
+
+	// Barrett reduction to 32 bits
+	x2 = _mm_and_si128(x1, mask32);
+	x2 = _mm_clmulepi64_si128(x2, poly, 0x10);
+	x2 = _mm_and_si128(x2, mask32);
+	x2 = _mm_clmulepi64_si128(x2, poly, 0x00);
+	x1 = _mm_xor_si128(x1, x2);
+
+	return static_cast<uint32_t>(_mm_extract_epi32(x1, 1));
+}
+
+inline uint32_t crc32_pclmul(uint32_t crc, const std::byte* data, std::size_t len)
+{
+	if (len >= 64)
+	{
+		const std::size_t chunk = len & ~std::size_t{15};
+		crc						= ~crc32_fold_pclmul(~crc, data, chunk);
+		data += chunk;
+		len -= chunk;
+	}
+	return crc32_slicing16(crc, data, len);
+}
+
+#endif
+
+// === DISPATCH ===
+
+inline Crc32Kernel select_crc32_kernel()
+{
+#if CT_STR_X86_DISPATCH
+	if (cpu_features().pclmul && cpu_features().sse41)
+		return &crc32_pclmul;
+#endif
+	return &crc32_slicing16;
+}
+
+inline uint32_t crc32_resolve(uint32_t crc, const std::byte* data, std::size_t len);
+
+// Starts out pointing at the resolver, which runs CPUID once and replaces itself with the chosen kernel
+inline std::atomic<Crc32Kernel> crc32_kernel{&crc32_resolve};
+
+inline uint32_t crc32_resolve(uint32_t crc, const std::byte* data, std::size_t len)
+{
+	Crc32Kernel kernel = select_crc32_kernel();
+	crc32_kernel.store(kernel, std::memory_order_relaxed);
+	return kernel(crc, data, len);
+}
+
+// === API ===
+
+inline uint32_t crc32(std::span<const std::byte> data)
+{
+	return crc32_kernel.load(std::memory_order_relaxed)(0, data.data(), data.size());
+}
+
+inline uint32_t crc32(std::string_view str)
+{
+	return crc32(std::as_bytes(std::span(str.data(), str.size())));
+}
+
+// Incremental CRC-32: update() any number of times, then read value()
+class Crc32
+{
+public:
+	Crc32& update(std::span<const std::byte> data)
+	{
+		crc_ = crc32_kernel.load(std::memory_order_relaxed)(crc_, data.data(), data.size());
+		return *this;
+	}
+
+	Crc32& update(std::string_view str) { return update(std::as_bytes(std::span(str.data(), str.size()))); }
+
+	uint32_t value() const { return crc_; }
+	void	 reset() { crc_ = 0; }
+
+private:
+	uint32_t crc_ = 0;
+};
+
+}  // namespace ct_str::rt
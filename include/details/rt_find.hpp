@@ -0,0 +1,237 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#pragma once
+
+#include "cpu_features.hpp"
+#include "fixed_string.hpp"
+#include "key_pack.hpp"
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace ct_str
+{
+
+// === BYTE FREQUENCY ===
+
+// Rough frequency rank of each byte value in text, markup and protocol data (higher is more common). It only
+// has to order bytes well enough to pick a needle's rarest bytes, which the scan then looks for.
+consteval auto make_finder_byte_rank()
+{
+	struct Ranks
+	{
+		uint8_t rank[256]{};
+	} r{};
+
+	for (int b = 0x01; b < 0x20; ++b)
+		r.rank[b] = 5;
+	for (int b = 0x20; b < 0x7F; ++b)
+		r.rank[b] = 40;
+	for (int b = 0x80; b < 0x100; ++b)
+		r.rank[b] = 10;
+	r.rank[0x00] = 60;
+	r.rank[0xFF] = 20;
+
+	const char* lower = "etaoinsrhldcumfpgwybvkxjqz";
+	for (int i = 0; lower[i] != '\0'; ++i)
+	{
+		r.rank[static_cast<uint8_t>(lower[i])]		  = static_cast<uint8_t>(250 - 4 * i);
+		r.rank[static_cast<uint8_t>(lower[i] - 0x20)] = static_cast<uint8_t>(160 - 4 * i);
+	}
+	for (int d = 0; d < 10; ++d)
+		r.rank['0' + d] = static_cast<uint8_t>(d < 3 ? 170 - 5 * d : 150);
+
+	struct Common
+	{
+		char	c;
+		uint8_t rank;
+	};
+	constexpr Common common[] = {{' ', 255}, {'\n', 120}, {'\r', 110}, {'\t', 80}, {'.', 140}, {'/', 130},
+								 {',', 120}, {'-', 120}, {':', 110}, {'=', 110}, {'"', 110}, {'_', 100},
+								 {'(', 80},	 {')', 80},	 {';', 80},	 {'\'', 80}, {'&', 70},	 {'<', 70},
+								 {'>', 70},	 {'{', 60},	 {'}', 60},	 {'[', 60},	 {']', 60},	 {'%', 60},
+								 {'?', 60},	 {'@', 50},	 {'!', 50},	 {'+', 50},	 {'#', 40},	 {'*', 40},
+								 {'\\', 40}, {'$', 30},	 {'|', 30},	 {'~', 20},	 {'^', 20},	 {'`', 20}};
+	for (const Common& c : common)
+		r.rank[static_cast<uint8_t>(c.c)] = c.rank;
+	return r;
+}
+
+inline constexpr auto finder_byte_rank = make_finder_byte_rank();
+
+// Offsets of the needle's two rarest bytes. The second prefers a byte value different from the first, so
+// that the pair rejects more positions than either byte alone.
+struct FinderProbe
+{
+	std::size_t first  = 0;
+	std::size_t second = 0;
+};
+
+template <typename CharT>
+consteval FinderProbe finder_probe(const CharT* needle, std::size_t len)
+{
+	FinderProbe probe{};
+	auto		rank = [&](std::size_t i) { return finder_byte_rank.rank[static_cast<uint8_t>(needle[i])]; };
+	for (std::size_t i = 1; i < len; ++i)
+	{
+		if (rank(i) < rank(probe.first))
+			probe.first = i;
+	}
+
+	bool found = false;
+	for (int pass = 0; pass < 2 && !found; ++pass)
+	{
+		for (std::size_t i = 0; i < len; ++i)
+		{
+			if (i == probe.first || (pass == 0 && needle[i] == needle[probe.first]))
+				continue;
+			if (!found || rank(i) < rank(probe.second))
+			{
+				probe.second = i;
+				found		 = true;
+			}
+		}
+	}
+	if (!found)
+		probe.second = probe.first;
+	return probe;
+}
+
+// === FINDER ===
+
+// Runtime substring search for a needle known at compile time. Candidate positions are those where the
+// needle's two rarest bytes line up; they are found 16 (SSE2) or 32 (AVX2) positions at a time with byte
+// compares and confirmed with a fixed-length word compare. find() follows ct_str::find<Str, Needle, StartPos>:
+// an empty needle is found at start, a needle longer than the haystack or a start at or past its end returns
+// the haystack size, and a needle that does not occur returns npos.
+//
+//	using HeaderEnd = ct_str::finder<"\r\n\r\n">;
+//	std::size_t end = HeaderEnd::find(buffer);
+template <FixedString Needle>
+struct finder
+{
+	using CharT		 = typename decltype(Needle)::value_type;
+	using value_type = CharT;
+	static_assert(sizeof(CharT) == 1, "finder: needle must use a byte-sized character type");
+
+	static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+	static constexpr std::size_t N	  = Needle.size();
+
+	static constexpr FinderProbe probe = finder_probe(Needle.data, N);
+
+	static constexpr std::size_t size() { return N; }
+
+	static constexpr std::size_t find(std::basic_string_view<CharT> haystack, std::size_t start = 0)
+	{
+		const std::size_t len = haystack.size();
+		if constexpr (N == 0)
+			return start;
+		else
+		{
+			if (N > len || start >= len)
+				return len;
+			if (std::is_constant_evaluated())
+				return find_scalar(haystack.data(), len, start);
+			return kernel.load(std::memory_order_relaxed)(haystack.data(), len, start);
+		}
+	}
+
+	static constexpr bool contains(std::basic_string_view<CharT> haystack) { return find(haystack) < haystack.size(); }
+
+	// Kernels take len >= N and start < len, and return the first match at or after start, or npos
+
+	static constexpr bool candidate(const CharT* at)
+	{
+		return at[probe.first] == Needle.data[probe.first] && at[probe.second] == Needle.data[probe.second] &&
+			   key_equal(Needle.data, at, N);
+	}
+
+	static constexpr std::size_t find_scalar(const CharT* hay, std::size_t len, std::size_t start)
+	{
+		for (std::size_t i = start; i + N <= len; ++i)
+		{
+			if (candidate(hay + i))
+				return i;
+		}
+		return npos;
+	}
+
+#if CT_STR_X86_DISPATCH
+	CT_STR_TARGET("sse2")
+	static std::size_t find_sse2(const CharT* hay, std::size_t len, std::size_t start)
+	{
+		const __m128i first	 = _mm_set1_epi8(static_cast<char>(Needle.data[probe.first]));
+		const __m128i second = _mm_set1_epi8(static_cast<char>(Needle.data[probe.second]));
+		std::size_t	  i		 = start;
+		for (; i + 16 + N - 1 <= len; i += 16)
+		{
+			const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(hay + i + probe.first));
+			const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(hay + i + probe.second));
+			uint32_t mask = static_cast<uint32_t>(
+				_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, second))));
+			for (; mask != 0; mask &= mask - 1)
+			{
+				const std::size_t at = i + static_cast<std::size_t>(std::countr_zero(mask));
+				if (key_equal(Needle.data, hay + at, N))
+					return at;
+			}
+		}
+		return find_scalar(hay, len, i);
+	}
+
+	CT_STR_TARGET("avx2")
+	static std::size_t find_avx2(const CharT* hay, std::size_t len, std::size_t start)
+	{
+		const __m256i first	 = _mm256_set1_epi8(static_cast<char>(Needle.data[probe.first]));
+		const __m256i second = _mm256_set1_epi8(static_cast<char>(Needle.data[probe.second]));
+		std::size_t	  i		 = start;
+		for (; i + 32 + N - 1 <= len; i += 32)
+		{
+			const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(hay + i + probe.first));
+			const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(hay + i + probe.second));
+			uint32_t mask = static_cast<uint32_t>(
+				_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(a, first), _mm256_cmpeq_epi8(b, second))));
+			for (; mask != 0; mask &= mask - 1)
+			{
+				const std::size_t at = i + static_cast<std::size_t>(std::countr_zero(mask));
+				if (key_equal(Needle.data, hay + at, N))
+					return at;
+			}
+		}
+		return find_sse2(hay, len, i);
+	}
+#endif
+
+	// === DISPATCH ===
+
+	using Kernel = std::size_t (*)(const CharT* hay, std::size_t len, std::size_t start);
+
+	static Kernel select_kernel()
+	{
+#if CT_STR_X86_DISPATCH
+		if (rt::cpu_features().avx2)
+			return &find_avx2;
+		return &find_sse2;
+#else
+		return &find_scalar;
+#endif
+	}
+
+	static std::size_t resolve(const CharT* hay, std::size_t len, std::size_t start)
+	{
+		Kernel k = select_kernel();
+		kernel.store(k, std::memory_order_relaxed);
+		return k(hay, len, start);
+	}
+
+	// Starts out pointing at the resolver, which replaces itself with the chosen kernel
+	static inline std::atomic<Kernel> kernel{&resolve};
+};
+
+}  // namespace ct_str
@@ -0,0 +1,635 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#pragma once
+
+#include "byte_store.hpp"
+#include "cpu_features.hpp"
+#include "hash.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace ct_str::rt
+{
+
+// Runtime SHA-2 producing exactly the digests of ct_str::sha256<Str> / ct_str::sha512<Str>. The streaming
+// classes reuse Sha2Engine's buffering and padding and only swap in faster block functions; the batch
+// functions hash many independent messages at once.
+
+// === SHA-256 BLOCK KERNELS ===
+
+using Sha256BlockKernel = void (*)(uint32_t (&state)[8], const std::byte* data, std::size_t blocks);
+
+inline void sha256_blocks_scalar(uint32_t (&state)[8], const std::byte* data, std::size_t blocks)
+{
+	Sha256Traits::compress_blocks(state, data, blocks);
+}
+
+#if CT_STR_X86_DISPATCH
+
+// Four rounds of SHA-NI. The message schedule lives in m[0..3] as a rolling window; group G loads or extends
+// the window as needed, so the 16 groups of a block unroll into straight-line code.
+template <int G>
+CT_STR_TARGET("sha,sse4.1")
+inline void sha256_shani_group(__m128i& state0, __m128i& state1, __m128i (&m)[4], const std::byte* data, __m128i mask)
+{
+	if constexpr (G < 4)
+		m[G] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + G * 16)), mask);
+
+	__m128i msg = _mm_add_epi32(m[G % 4], _mm_loadu_si128(reinterpret_cast<const __m128i*>(sha256_k + G * 4)));
+	state1		= _mm_sha256rnds2_epu32(state1, state0, msg);
+	if constexpr (G >= 3 && G <= 14)
+	{
+		__m128i tmp	   = _mm_alignr_epi8(m[G % 4], m[(G + 3) % 4], 4);
+		m[(G + 1) % 4] = _mm_sha256msg2_epu32(_mm_add_epi32(m[(G + 1) % 4], tmp), m[G % 4]);
+	}
+	msg	   = _mm_shuffle_epi32(msg, 0x0E);
+	state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+	if constexpr (G >= 1 && G <= 12)
+		m[(G + 3) % 4] = _mm_sha256msg1_epu32(m[(G + 3) % 4], m[G % 4]);
+}
+
+CT_STR_TARGET("sha,sse4.1")
+inline void sha256_blocks_shani(uint32_t (&state)[8], const std::byte* data, std::size_t blocks)
+{
+	const __m128i mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+	// Rearrange the state into the ABEF/CDGH layout used by SHA256RNDS2
+	__m128i tmp	   = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[0])), 0xB1);
+	__m128i state1 = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[4])), 0x1B);
+	__m128i state0 = _mm_alignr_epi8(tmp, state1, 8);
+	state1		   = _mm_blend_epi16(state1, tmp, 0xF0);
+
+	for (; blocks > 0; --blocks, data += 64)
+	{
+		const __m128i abef = state0;
+		const __m128i cdgh = state1;
+		__m128i		  m[4];
+
+		sha256_shani_group<0>(state0, state1, m, data, mask);
+		sha256_shani_group<1>(state0, state1, m, data, mask);
+		sha256_shani_group<2>(state0, state1, m, data, mask);
+		sha256_shani_group<3>(state0, state1, m, data, mask);
+		sha256_shani_group<4>(state0, state1, m, data, mask);
+		sha256_shani_group<5>(state0, state1, m, data, mask);
+		sha256_shani_group<6>(state0, state1, m, data, mask);
+		sha256_shani_group<7>(state0, state1, m, data, mask);
+		sha256_shani_group<8>(state0, state1, m, data, mask);
+		sha256_shani_group<9>(state0, state1, m, data, mask);
+		sha256_shani_group<10>(state0, state1, m, data, mask);
+		sha256_shani_group<11>(state0, state1, m, data, mask);
+		sha256_shani_group<12>(state0, state1, m, data, mask);
+		sha256_shani_group<13>(state0, state1, m, data, mask);
+		sha256_shani_group<14>(state0, state1, m, data, mask);
+		sha256_shani_group<15>(state0, state1, m, data, mask);
+
+		state0 = _mm_add_epi32(state0, abef);
+		state1 = _mm_add_epi32(state1, cdgh);
+	}
+
+	// Back to ABCD/EFGH
+	tmp	   = _mm_shuffle_epi32(state0, 0x1B);
+	state1 = _mm_shuffle_epi32(state1, 0xB1);
+	state0 = _mm_blend_epi16(tmp, state1, 0xF0);
+	state1 = _mm_alignr_epi8(state1, tmp, 8);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&state[0]), state0);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&state[4]), state1);
+}
+
+#endif
+
+inline Sha256BlockKernel select_sha256_kernel()
+{
+#if CT_STR_X86_DISPATCH
+	if (cpu_features().sha && cpu_features().sse41)
+		return &sha256_blocks_shani;
+#endif
+	return &sha256_blocks_scalar;
+}
+
+inline void sha256_resolve(uint32_t (&state)[8], const std::byte* data, std::size_t blocks);
+
+// Starts out pointing at the resolver, which runs CPUID once and replaces itself with the chosen kernel
+inline std::atomic<Sha256BlockKernel> sha256_kernel{&sha256_resolve};
+
+inline void sha256_resolve(uint32_t (&state)[8], const std::byte* data, std::size_t blocks)
+{
+	Sha256BlockKernel kernel = select_sha256_kernel();
+	sha256_kernel.store(kernel, std::memory_order_relaxed);
+	kernel(state, data, blocks);
+}
+
+// === SHA-256 STREAMING ===
+
+struct Sha256RuntimeTraits : Sha256Traits
+{
+	static void compress_blocks(uint32_t (&state)[8], const auto* data, std::size_t blocks)
+	{
+		sha256_kernel.load(std::memory_order_relaxed)(state, reinterpret_cast<const std::byte*>(data), blocks);
+	}
+};
+
+// Incremental SHA-256: update() any number of times, then finish()
+class Sha256
+{
+public:
+	Sha256& update(std::span<const std::byte> data)
+	{
+		engine_.update(data.data(), data.size());
+		return *this;
+	}
+
+	Sha256& update(std::string_view str) { return update(std::as_bytes(std::span(str.data(), str.size()))); }
+
+	FixedBytes<32> finish() { return engine_.finish(); }
+
+private:
+	Sha2Engine<Sha256RuntimeTraits> engine_;
+};
+
+inline FixedBytes<32> sha256(std::span<const std::byte> data)
+{
+	return Sha256{}.update(data).finish();
+}
+
+inline FixedBytes<32> sha256(std::string_view str)
+{
+	return Sha256{}.update(str).finish();
+}
+
+// === SHA-512 STREAMING ===
+
+// Incremental SHA-512 for large inputs: update() any number of times, then finish(). The scalar 64-bit
+// compression function is the fastest single-message option on CPUs without the SHA512 extensions.
+class Sha512
+{
+public:
+	Sha512& update(std::span<const std::byte> data)
+	{
+		engine_.update(data.data(), data.size());
+		return *this;
+	}
+
+	Sha512& update(std::string_view str) { return update(std::as_bytes(std::span(str.data(), str.size()))); }
+
+	FixedBytes<64> finish() { return engine_.finish(); }
+
+private:
+	Sha512Engine engine_;
+};
+
+inline FixedBytes<64> sha512(std::span<const std::byte> data)
+{
+	return Sha512{}.update(data).finish();
+}
+
+inline FixedBytes<64> sha512(std::string_view str)
+{
+	return Sha512{}.update(str).finish();
+}
+
+// === MULTI-BUFFER BATCHING ===
+
+// Final one or two blocks of a message: trailing bytes, 0x80, zero fill and the big-endian bit length
+template <typename Traits>
+struct Sha2Tail
+{
+	static constexpr std::size_t block_size = Traits::block_size;
+
+	std::byte	data[block_size * 2];
+	std::size_t full_blocks;
+	std::size_t total_blocks;
+
+	Sha2Tail() = default;
+
+	explicit Sha2Tail(std::span<const std::byte> msg)
+		: data{}
+	{
+		const std::size_t rem = msg.size() % block_size;
+		full_blocks			  = msg.size() / block_size;
+		for (std::size_t i = 0; i < rem; ++i)
+			data[i] = msg[full_blocks * block_size + i];
+		data[rem]				= std::byte{0x80};
+		const std::size_t tail	= (rem + 1 + Traits::length_size > block_size) ? 2 : 1;
+		const uint64_t	  bits	= static_cast<uint64_t>(msg.size()) * 8;
+		for (int i = 0; i < 8; ++i)
+			data[tail * block_size - 1 - i] = static_cast<std::byte>(bits >> (i * 8));
+		total_blocks = full_blocks + tail;
+	}
+};
+
+// Compresses one block in each of Lanes lanes; lanes whose bit in active is clear keep their state.
+// state[w][lane] is word w of a lane's state.
+template <typename Traits, std::size_t Lanes>
+using Sha2LanesKernel = void (*)(typename Traits::word_type (&state)[8][Lanes], const std::byte* const (&blocks)[Lanes],
+								 unsigned active);
+
+// Runs messages through a multi-lane kernel Lanes at a time. Messages of different lengths are handled by
+// masking lanes that have run out of blocks, so batches of similar lengths make the best use of the lanes.
+template <typename Traits, std::size_t Lanes, Sha2LanesKernel<Traits, Lanes> Kernel>
+void sha2_batch_lanes(std::span<const std::span<const std::byte>> messages,
+					  std::span<FixedBytes<Traits::digest_size>>  digests)
+{
+	using word_type							= typename Traits::word_type;
+	static constexpr std::size_t block_size = Traits::block_size;
+	static constexpr std::byte	 idle_block[block_size]{};
+
+	for (std::size_t base = 0; base < messages.size(); base += Lanes)
+	{
+		const std::size_t lanes = (messages.size() - base < Lanes) ? messages.size() - base : Lanes;
+
+		Sha2Tail<Traits> tails[Lanes];
+		std::size_t		 max_blocks = 0;
+		for (std::size_t lane = 0; lane < lanes; ++lane)
+		{
+			tails[lane] = Sha2Tail<Traits>(messages[base + lane]);
+			max_blocks	= (tails[lane].total_blocks > max_blocks) ? tails[lane].total_blocks : max_blocks;
+		}
+
+		alignas(64) word_type state[8][Lanes];
+		for (std::size_t i = 0; i < 8; ++i)
+		{
+			for (std::size_t lane = 0; lane < Lanes; ++lane)
+				state[i][lane] = Traits::initial_state[i];
+		}
+
+		for (std::size_t block = 0; block < max_blocks; ++block)
+		{
+			const std::byte* ptrs[Lanes];
+			unsigned		 active = 0;
+			for (std::size_t lane = 0; lane < Lanes; ++lane)
+			{
+				if (lane >= lanes || block >= tails[lane].total_blocks)
+				{
+					ptrs[lane] = idle_block;
+					continue;
+				}
+				active |= 1u << lane;
+				if (block < tails[lane].full_blocks)
+					ptrs[lane] = messages[base + lane].data() + block * block_size;
+				else
+					ptrs[lane] = tails[lane].data + (block - tails[lane].full_blocks) * block_size;
+			}
+			Kernel(state, ptrs, active);
+		}
+
+		// Each lane's state words, big-endian, are its digest
+		for (std::size_t lane = 0; lane < lanes; ++lane)
+		{
+			FixedBytes<Traits::digest_size>& out = digests[base + lane];
+			for (std::size_t i = 0; i < 8; ++i)
+			{
+				for (std::size_t j = 0; j < sizeof(word_type); ++j)
+					out.data[i * sizeof(word_type) + j] =
+						static_cast<uint8_t>(state[i][lane] >> ((sizeof(word_type) - 1 - j) * 8));
+			}
+		}
+	}
+}
+
+#if CT_STR_X86_DISPATCH
+
+// --- SHA-256, 8 lanes of AVX2 ---
+
+CT_STR_TARGET("avx2")
+inline __m256i sha256_rotr_x8(__m256i x, int n)
+{
+	return _mm256_or_si256(_mm256_srli_epi32(x, n), _mm256_slli_epi32(x, 32 - n));
+}
+
+// Transpose eight rows of eight 32-bit words so that r[w] holds word w of every row
+CT_STR_TARGET("avx2")
+inline void transpose_8x32(__m256i (&r)[8])
+{
+	__m256i t[8], u[8];
+	for (int i = 0; i < 4; ++i)
+	{
+		t[2 * i]	 = _mm256_unpacklo_epi32(r[2 * i], r[2 * i + 1]);
+		t[2 * i + 1] = _mm256_unpackhi_epi32(r[2 * i], r[2 * i + 1]);
+	}
+	for (int i = 0; i < 2; ++i)
+	{
+		u[4 * i]	 = _mm256_unpacklo_epi64(t[4 * i], t[4 * i + 2]);
+		u[4 * i + 1] = _mm256_unpackhi_epi64(t[4 * i], t[4 * i + 2]);
+		u[4 * i + 2] = _mm256_unpacklo_epi64(t[4 * i + 1], t[4 * i + 3]);
+		u[4 * i + 3] = _mm256_unpackhi_epi64(t[4 * i + 1], t[4 * i + 3]);
+	}
+	for (int i = 0; i < 4; ++i)
+	{
+		r[i]	 = _mm256_permute2x128_si256(u[i], u[i + 4], 0x20);
+		r[i + 4] = _mm256_permute2x128_si256(u[i], u[i + 4], 0x31);
+	}
+}
+
+CT_STR_TARGET("avx2")
+inline void sha256_compress_x8(uint32_t (&state)[8][8], const std::byte* const (&blocks)[8], unsigned active)
+{
+	const __m256i bswap = _mm256_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3, 12, 13, 14, 15, 8, 9,
+										  10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+
+	// Message words 0-15 for all lanes, byte-swapped to big-endian
+	__m256i w[16];
+	for (int half = 0; half < 2; ++half)
+	{
+		__m256i rows[8];
+		for (int lane = 0; lane < 8; ++lane)
+			rows[lane] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(blocks[lane] + half * 32));
+		transpose_8x32(rows);
+		for (int i = 0; i < 8; ++i)
+			w[half * 8 + i] = _mm256_shuffle_epi8(rows[i], bswap);
+	}
+
+	__m256i s[8];
+	for (int i = 0; i < 8; ++i)
+		s[i] = _mm256_load_si256(reinterpret_cast<const __m256i*>(state[i]));
+	__m256i a = s[0], b = s[1], c = s[2], d = s[3], e = s[4], f = s[5], g = s[6], h = s[7];
+
+	for (int i = 0; i < 64; ++i)
+	{
+		// Extend the schedule in a 16-word ring
+		if (i >= 16)
+		{
+			__m256i w15 = w[(i - 15) & 15];
+			__m256i w2	= w[(i - 2) & 15];
+			__m256i s0	= _mm256_xor_si256(_mm256_xor_si256(sha256_rotr_x8(w15, 7), sha256_rotr_x8(w15, 18)),
+										   _mm256_srli_epi32(w15, 3));
+			__m256i s1	= _mm256_xor_si256(_mm256_xor_si256(sha256_rotr_x8(w2, 17), sha256_rotr_x8(w2, 19)),
+										   _mm256_srli_epi32(w2, 10));
+			w[i & 15]	= _mm256_add_epi32(_mm256_add_epi32(w[i & 15], s0), _mm256_add_epi32(w[(i - 7) & 15], s1));
+		}
+
+		__m256i S1 =
+			_mm256_xor_si256(_mm256_xor_si256(sha256_rotr_x8(e, 6), sha256_rotr_x8(e, 11)), sha256_rotr_x8(e, 25));
+		__m256i ch	  = _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+		__m256i kw	  = _mm256_add_epi32(_mm256_set1_epi32(static_cast<int>(sha256_k[i])), w[i & 15]);
+		__m256i temp1 = _mm256_add_epi32(_mm256_add_epi32(h, S1), _mm256_add_epi32(ch, kw));
+		__m256i S0 =
+			_mm256_xor_si256(_mm256_xor_si256(sha256_rotr_x8(a, 2), sha256_rotr_x8(a, 13)), sha256_rotr_x8(a, 22));
+		__m256i maj = _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_or_si256(a, b)));
+
+		h = g;
+		g = f;
+		f = e;
+		e = _mm256_add_epi32(d, temp1);
+		d = c;
+		c = b;
+		b = a;
+		a = _mm256_add_epi32(temp1, _mm256_add_epi32(S0, maj));
+	}
+
+	// Per-lane mask from the active bits
+	const __m256i bits = _mm256_set_epi32(128, 64, 32, 16, 8, 4, 2, 1);
+	const __m256i mask =
+		_mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(static_cast<int>(active)), bits), bits);
+	const __m256i next[8] = {a, b, c, d, e, f, g, h};
+	for (int i = 0; i < 8; ++i)
+		_mm256_store_si256(reinterpret_cast<__m256i*>(state[i]),
+						   _mm256_blendv_epi8(s[i], _mm256_add_epi32(s[i], next[i]), mask));
+}
+
+// --- SHA-512, 4 lanes of AVX2 ---
+
+CT_STR_TARGET("avx2")
+inline __m256i sha512_rotr_x4(__m256i x, int n)
+{
+	return _mm256_or_si256(_mm256_srli_epi64(x, n), _mm256_slli_epi64(x, 64 - n));
+}
+
+CT_STR_TARGET("avx2")
+inline void sha512_compress_x4(uint64_t (&state)[8][4], const std::byte* const (&blocks)[4], unsigned active)
+{
+	const __m256i bswap = _mm256_set_epi8(8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+										  14, 15, 0, 1, 2, 3, 4, 5, 6, 7);
+
+	// Message words 0-15 for all lanes: four 4x4 transposes of 64-bit words, then byte swaps
+	__m256i w[16];
+	for (int quarter = 0; quarter < 4; ++quarter)
+	{
+		__m256i r[4];
+		for (int lane = 0; lane < 4; ++lane)
+			r[lane] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(blocks[lane] + quarter * 32));
+		const __m256i t0 = _mm256_unpacklo_epi64(r[0], r[1]);
+		const __m256i t1 = _mm256_unpackhi_epi64(r[0], r[1]);
+		const __m256i t2 = _mm256_unpacklo_epi64(r[2], r[3]);
+		const __m256i t3 = _mm256_unpackhi_epi64(r[2], r[3]);
+		w[quarter * 4 + 0] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(t0, t2, 0x20), bswap);
+		w[quarter * 4 + 1] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(t1, t3, 0x20), bswap);
+		w[quarter * 4 + 2] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(t0, t2, 0x31), bswap);
+		w[quarter * 4 + 3] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(t1, t3, 0x31), bswap);
+	}
+
+	__m256i s[8];
+	for (int i = 0; i < 8; ++i)
+		s[i] = _mm256_load_si256(reinterpret_cast<const __m256i*>(state[i]));
+	__m256i a = s[0], b = s[1], c = s[2], d = s[3], e = s[4], f = s[5], g = s[6], h = s[7];
+
+	for (int i = 0; i < 80; ++i)
+	{
+		if (i >= 16)
+		{
+			__m256i w15 = w[(i - 15) & 15];
+			__m256i w2	= w[(i - 2) & 15];
+			__m256i s0	= _mm256_xor_si256(_mm256_xor_si256(sha512_rotr_x4(w15, 1), sha512_rotr_x4(w15, 8)),
+										   _mm256_srli_epi64(w15, 7));
+			__m256i s1	= _mm256_xor_si256(_mm256_xor_si256(sha512_rotr_x4(w2, 19), sha512_rotr_x4(w2, 61)),
+										   _mm256_srli_epi64(w2, 6));
+			w[i & 15]	= _mm256_add_epi64(_mm256_add_epi64(w[i & 15], s0), _mm256_add_epi64(w[(i - 7) & 15], s1));
+		}
+
+		__m256i S1 =
+			_mm256_xor_si256(_mm256_xor_si256(sha512_rotr_x4(e, 14), sha512_rotr_x4(e, 18)), sha512_rotr_x4(e, 41));
+		__m256i ch	  = _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+		__m256i kw	  = _mm256_add_epi64(_mm256_set1_epi64x(static_cast<long long>(sha512_k[i])), w[i & 15]);
+		__m256i temp1 = _mm256_add_epi64(_mm256_add_epi64(h, S1), _mm256_add_epi64(ch, kw));
+		__m256i S0 =
+			_mm256_xor_si256(_mm256_xor_si256(sha512_rotr_x4(a, 28), sha512_rotr_x4(a, 34)), sha512_rotr_x4(a, 39));
+		__m256i maj = _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_or_si256(a, b)));
+
+		h = g;
+		g = f;
+		f = e;
+		e = _mm256_add_epi64(d, temp1);
+		d = c;
+		c = b;
+		b = a;
+		a = _mm256_add_epi64(temp1, _mm256_add_epi64(S0, maj));
+	}
+
+	const __m256i bits	  = _mm256_set_epi64x(8, 4, 2, 1);
+	const __m256i mask	  = _mm256_cmpeq_epi64(_mm256_and_si256(_mm256_set1_epi64x(active), bits), bits);
+	const __m256i next[8] = {a, b, c, d, e, f, g, h};
+	for (int i = 0; i < 8; ++i)
+		_mm256_store_si256(reinterpret_cast<__m256i*>(state[i]),
+						   _mm256_blendv_epi8(s[i], _mm256_add_epi64(s[i], next[i]), mask));
+}
+
+// --- SHA-512, 8 lanes of AVX-512 ---
+
+// GCC's AVX-512 intrinsics start from _mm512_undefined_epi32(), which -Wall reports as uninitialized once
+// inlined here
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+CT_STR_TARGET("avx512f,avx512bw")
+inline void sha512_compress_x8(uint64_t (&state)[8][8], const std::byte* const (&blocks)[8], unsigned active)
+{
+	const __m512i bswap = _mm512_broadcast_i32x4(_mm_set_epi8(8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7));
+
+	// Message words 0-15 for all lanes: two 8x8 transposes of 64-bit words, then byte swaps
+	__m512i w[16];
+	for (int half = 0; half < 2; ++half)
+	{
+		__m512i r[8], t[8], u[8];
+		for (int lane = 0; lane < 8; ++lane)
+			r[lane] = _mm512_loadu_si512(blocks[lane] + half * 64);
+		for (int i = 0; i < 4; ++i)
+		{
+			t[2 * i]	 = _mm512_unpacklo_epi64(r[2 * i], r[2 * i + 1]);
+			t[2 * i + 1] = _mm512_unpackhi_epi64(r[2 * i], r[2 * i + 1]);
+		}
+		for (int i = 0; i < 2; ++i)
+		{
+			u[4 * i]	 = _mm512_shuffle_i64x2(t[4 * i], t[4 * i + 2], 0x88);
+			u[4 * i + 1] = _mm512_shuffle_i64x2(t[4 * i], t[4 * i + 2], 0xDD);
+			u[4 * i + 2] = _mm512_shuffle_i64x2(t[4 * i + 1], t[4 * i + 3], 0x88);
+			u[4 * i + 3] = _mm512_shuffle_i64x2(t[4 * i + 1], t[4 * i + 3], 0xDD);
+		}
+		__m512i* out = w + half * 8;
+		out[0]		 = _mm512_shuffle_i64x2(u[0], u[4], 0x88);
+		out[4]		 = _mm512_shuffle_i64x2(u[0], u[4], 0xDD);
+		out[2]		 = _mm512_shuffle_i64x2(u[1], u[5], 0x88);
+		out[6]		 = _mm512_shuffle_i64x2(u[1], u[5], 0xDD);
+		out[1]		 = _mm512_shuffle_i64x2(u[2], u[6], 0x88);
+		out[5]		 = _mm512_shuffle_i64x2(u[2], u[6], 0xDD);
+		out[3]		 = _mm512_shuffle_i64x2(u[3], u[7], 0x88);
+		out[7]		 = _mm512_shuffle_i64x2(u[3], u[7], 0xDD);
+		for (int i = 0; i < 8; ++i)
+			out[i] = _mm512_shuffle_epi8(out[i], bswap);
+	}
+
+	__m512i s[8];
+	for (int i = 0; i < 8; ++i)
+		s[i] = _mm512_load_si512(state[i]);
+	__m512i a = s[0], b = s[1], c = s[2], d = s[3], e = s[4], f = s[5], g = s[6], h = s[7];
+
+	for (int i = 0; i < 80; ++i)
+	{
+		if (i >= 16)
+		{
+			__m512i w15 = w[(i - 15) & 15];
+			__m512i w2	= w[(i - 2) & 15];
+			__m512i s0	= _mm512_ternarylogic_epi64(_mm512_ror_epi64(w15, 1), _mm512_ror_epi64(w15, 8),
+													_mm512_srli_epi64(w15, 7), 0x96);
+			__m512i s1	= _mm512_ternarylogic_epi64(_mm512_ror_epi64(w2, 19), _mm512_ror_epi64(w2, 61),
+													_mm512_srli_epi64(w2, 6), 0x96);
+			w[i & 15]	= _mm512_add_epi64(_mm512_add_epi64(w[i & 15], s0), _mm512_add_epi64(w[(i - 7) & 15], s1));
+		}
+
+		// 0x96 is a three-way XOR, 0xCA is (e & f) | (~e & g), 0xE8 is majority
+		__m512i S1 =
+			_mm512_ternarylogic_epi64(_mm512_ror_epi64(e, 14), _mm512_ror_epi64(e, 18), _mm512_ror_epi64(e, 41), 0x96);
+		__m512i ch	  = _mm512_ternarylogic_epi64(e, f, g, 0xCA);
+		__m512i kw	  = _mm512_add_epi64(_mm512_set1_epi64(static_cast<long long>(sha512_k[i])), w[i & 15]);
+		__m512i temp1 = _mm512_add_epi64(_mm512_add_epi64(h, S1), _mm512_add_epi64(ch, kw));
+		__m512i S0 =
+			_mm512_ternarylogic_epi64(_mm512_ror_epi64(a, 28), _mm512_ror_epi64(a, 34), _mm512_ror_epi64(a, 39), 0x96);
+		__m512i maj = _mm512_ternarylogic_epi64(a, b, c, 0xE8);
+
+		h = g;
+		g = f;
+		f = e;
+		e = _mm512_add_epi64(d, temp1);
+		d = c;
+		c = b;
+		b = a;
+		a = _mm512_add_epi64(temp1, _mm512_add_epi64(S0, maj));
+	}
+
+	const __mmask8 mask	   = static_cast<__mmask8>(active);
+	const __m512i  next[8] = {a, b, c, d, e, f, g, h};
+	for (int i = 0; i < 8; ++i)
+		_mm512_store_si512(state[i], _mm512_mask_add_epi64(s[i], mask, s[i], next[i]));
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif
+
+// === BATCH API ===
+
+// One message at a time through the dispatched block kernel (SHA-NI where available)
+inline void sha256_batch_single(std::span<const std::span<const std::byte>> messages, std::span<FixedBytes<32>> digests)
+{
+	for (std::size_t i = 0; i < messages.size(); ++i)
+		digests[i] = sha256(messages[i]);
+}
+
+inline void sha512_batch_single(std::span<const std::span<const std::byte>> messages, std::span<FixedBytes<64>> digests)
+{
+	for (std::size_t i = 0; i < messages.size(); ++i)
+		digests[i] = sha512(messages[i]);
+}
+
+#if CT_STR_X86_DISPATCH
+
+inline void sha256_batch_avx2(std::span<const std::span<const std::byte>> messages, std::span<FixedBytes<32>> digests)
+{
+	sha2_batch_lanes<Sha256Traits, 8, &sha256_compress_x8>(messages, digests);
+}
+
+inline void sha512_batch_avx2(std::span<const std::span<const std::byte>> messages, std::span<FixedBytes<64>> digests)
+{
+	sha2_batch_lanes<Sha512Traits, 4, &sha512_compress_x4>(messages, digests);
+}
+
+inline void sha512_batch_avx512(std::span<const std::span<const std::byte>> messages, std::span<FixedBytes<64>> digests)
+{
+	sha2_batch_lanes<Sha512Traits, 8, &sha512_compress_x8>(messages, digests);
+}
+
+#endif
+
+// Hash messages[i] into digests[i]; digests must be at least as long as messages. Uses SHA-NI one message at
+// a time when available, otherwise the 8-lane AVX2 mode, otherwise the scalar engine.
+inline void sha256_batch(std::span<const std::span<const std::byte>> messages, std::span<FixedBytes<32>> digests)
+{
+#if CT_STR_X86_DISPATCH
+	if (!cpu_features().sha && cpu_features().avx2)
+	{
+		sha256_batch_avx2(messages, digests);
+		return;
+	}
+#endif
+	sha256_batch_single(messages, digests);
+}
+
+// Hash messages[i] into digests[i]; digests must be at least as long as messages. Uses 8 lanes of AVX-512 or
+// 4 lanes of AVX2 when available, otherwise the scalar engine.
+inline void sha512_batch(std::span<const std::span<const std::byte>> messages, std::span<FixedBytes<64>> digests)
+{
+#if CT_STR_X86_DISPATCH
+	if (cpu_features().avx512f && cpu_features().avx512bw)
+	{
+		sha512_batch_avx512(messages, digests);
+		return;
+	}
+	if (cpu_features().avx2)
+	{
+		sha512_batch_avx2(messages, digests);
+		return;
+	}
+#endif
+	sha512_batch_single(messages, digests);
+}
+
+}  // namespace ct_str::rt
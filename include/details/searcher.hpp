@@ -0,0 +1,256 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#pragma once
+
+#include "fixed_string.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace ct_str
+{
+
+// === TWO-WAY TABLES ===
+
+// Crochemore-Perrin Two-Way search state for one direction, with a Horspool shift table on the byte under the
+// last needle position. The needle splits at a critical position into a left and a right half; each window
+// compares the right half left to right, then the left half right to left. Periodic needles remember how much
+// of the left half the previous window already matched, which bounds the work to linear in the haystack.
+struct TwoWayTable
+{
+	std::size_t suffix	 = 0;  // start of the right half
+	std::size_t period	 = 1;
+	bool		periodic = false;
+	uint32_t	shift[256]{};  // distance from the last occurrence of a byte to the needle end; 0 for the last byte
+};
+
+template <typename CharT>
+consteval std::size_t two_way_max_suffix(const CharT* needle, std::size_t len, bool reversed, std::size_t& period)
+{
+	std::size_t max_suffix = static_cast<std::size_t>(-1);
+	std::size_t j		   = 0;
+	std::size_t k		   = 1;
+	std::size_t p		   = 1;
+	while (j + k < len)
+	{
+		const auto a = static_cast<std::make_unsigned_t<CharT>>(needle[j + k]);
+		const auto b = static_cast<std::make_unsigned_t<CharT>>(needle[max_suffix + k]);
+		if (reversed ? b < a : a < b)
+		{
+			j += k;
+			k = 1;
+			p = j - max_suffix;
+		}
+		else if (a == b)
+		{
+			if (k != p)
+				++k;
+			else
+			{
+				j += p;
+				k = 1;
+			}
+		}
+		else
+		{
+			max_suffix = j++;
+			k = p = 1;
+		}
+	}
+	period = p;
+	return max_suffix;
+}
+
+template <typename CharT>
+consteval TwoWayTable two_way_table(const CharT* needle, std::size_t len)
+{
+	TwoWayTable table{};
+	for (auto& s : table.shift)
+		s = static_cast<uint32_t>(len);
+	for (std::size_t i = 0; i < len; ++i)
+		table.shift[static_cast<uint8_t>(needle[i])] = static_cast<uint32_t>(len - 1 - i);
+
+	// Critical factorization: the later of the maximal suffixes under both byte orders
+	if (len < 3)
+	{
+		table.suffix = len == 0 ? 0 : len - 1;
+		table.period = 1;
+	}
+	else
+	{
+		std::size_t		  period = 1, period_rev = 1;
+		const std::size_t max_suffix	 = two_way_max_suffix(needle, len, false, period);
+		const std::size_t max_suffix_rev = two_way_max_suffix(needle, len, true, period_rev);
+		if (max_suffix_rev + 1 < max_suffix + 1)
+		{
+			table.suffix = max_suffix + 1;
+			table.period = period;
+		}
+		else
+		{
+			table.suffix = max_suffix_rev + 1;
+			table.period = period_rev;
+		}
+	}
+
+	// Periodic when the left half also occurs one period later
+	table.periodic = table.suffix + table.period <= len;
+	for (std::size_t i = 0; i < table.suffix && table.periodic; ++i)
+		table.periodic = needle[i] == needle[i + table.period];
+	if (!table.periodic)
+		table.period = (table.suffix > len - table.suffix ? table.suffix : len - table.suffix) + 1;
+	return table;
+}
+
+// First window at or after start where needle matches, in the coordinates of at(k), or -1. N > 0, len >= N.
+template <std::size_t N, typename CharT, typename At>
+constexpr std::size_t two_way_scan(const CharT* needle, const TwoWayTable& t, At at, std::size_t len,
+								   std::size_t start)
+{
+	const std::size_t suffix = t.suffix;
+	const std::size_t period = t.period;
+	std::size_t		  memory = 0;
+	for (std::size_t j = start; j <= len - N;)
+	{
+		std::size_t shift = t.shift[static_cast<uint8_t>(at(j + N - 1))];
+		if (shift > 0)
+		{
+			// The last byte cannot line up here; a skip past the remembered prefix forgets it
+			if (memory != 0 && shift < period)
+				shift = N - period;
+			memory = 0;
+			j += shift;
+			continue;
+		}
+
+		std::size_t i = suffix > memory ? suffix : memory;
+		while (i < N - 1 && needle[i] == at(i + j))
+			++i;
+		if (i < N - 1)
+		{
+			j += i - suffix + 1;
+			memory = 0;
+			continue;
+		}
+
+		// Right half matched; compare the left half down to what the previous window already matched
+		i = suffix - 1;
+		while (memory < i + 1 && needle[i] == at(i + j))
+			--i;
+		if (i + 1 < memory + 1)
+			return j;
+		j += period;
+		memory = t.periodic ? N - period : 0;
+	}
+	return static_cast<std::size_t>(-1);
+}
+
+template <typename CharT, std::size_t N>
+struct SearcherTables
+{
+	CharT		forward_needle[N + 1]{};
+	CharT		backward_needle[N + 1]{};
+	TwoWayTable forward{};
+	TwoWayTable backward{};
+};
+
+template <FixedString Pattern>
+consteval auto searcher_logic()
+{
+	using CharT			   = typename decltype(Pattern)::value_type;
+	constexpr std::size_t n = Pattern.size();
+
+	SearcherTables<CharT, n> tables{};
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		tables.forward_needle[i]		 = Pattern.data[i];
+		tables.backward_needle[n - 1 - i] = Pattern.data[i];
+	}
+	tables.forward	= two_way_table(tables.forward_needle, n);
+	tables.backward = two_way_table(tables.backward_needle, n);
+	return tables;
+}
+
+// === SEARCHER ===
+
+// Substring search for a pattern known at compile time, in time linear in the haystack for any input: the
+// Two-Way factorizations of the pattern and of its reverse, and their shift tables, are computed at compile
+// time. find, rfind and count follow ct_str::find, ct_str::rfind and ct_str::count_occurrences:
+//  - find(haystack, start): start for an empty pattern; the haystack size for a pattern longer than the
+//	  haystack or a start at or past its end; otherwise the first position at or after start, or npos.
+//  - rfind(haystack): the last position, or npos (also for an empty pattern).
+//  - count(haystack): non-overlapping occurrences, scanning left to right; 0 for an empty pattern.
+//
+//	using Boundary = ct_str::searcher<"--boundary">;
+//	std::size_t parts = Boundary::count(body);
+template <FixedString Pattern>
+struct searcher
+{
+	using CharT		 = typename decltype(Pattern)::value_type;
+	using value_type = CharT;
+	static_assert(sizeof(CharT) == 1, "searcher: pattern must use a byte-sized character type");
+
+	static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+	static constexpr std::size_t N	  = Pattern.size();
+	static constexpr auto		 tables = searcher_logic<Pattern>();
+
+	static constexpr std::size_t size() { return N; }
+
+	static constexpr std::size_t find(std::basic_string_view<CharT> haystack, std::size_t start = 0)
+	{
+		const std::size_t len = haystack.size();
+		if constexpr (N == 0)
+			return start;
+		else
+		{
+			if (N > len || start >= len)
+				return len;
+			const CharT* hay = haystack.data();
+			return two_way_scan<N>(tables.forward_needle, tables.forward, [hay](std::size_t k) { return hay[k]; }, len,
+								   start);
+		}
+	}
+
+	static constexpr std::size_t rfind(std::basic_string_view<CharT> haystack)
+	{
+		const std::size_t len = haystack.size();
+		if constexpr (N == 0)
+			return npos;
+		else
+		{
+			if (N > len)
+				return npos;
+			// Two-Way over the reversed haystack with the reversed pattern
+			const CharT*	  last = haystack.data() + len - 1;
+			const std::size_t pos  = two_way_scan<N>(tables.backward_needle, tables.backward,
+													 [last](std::size_t k) { return *(last - k); }, len, 0);
+			return pos == npos ? npos : len - N - pos;
+		}
+	}
+
+	static constexpr std::size_t count(std::basic_string_view<CharT> haystack)
+	{
+		if constexpr (N == 0)
+			return 0;
+		else
+		{
+			std::size_t total = 0;
+			for (std::size_t pos = 0; pos + N <= haystack.size(); pos += N)
+			{
+				pos = find(haystack, pos);
+				if (pos == npos)
+					break;
+				++total;
+			}
+			return total;
+		}
+	}
+
+	static constexpr bool contains(std::basic_string_view<CharT> haystack) { return find(haystack) < haystack.size(); }
+};
+
+}  // namespace ct_str
@@ -12,6 +12,84 @@ BSD-3-Clause License - See ct_str. hpp for full license text.
 namespace ct_str
 {
 
+// === PATTERN MATCHING CORE ===
+
+// Knuth-Morris-Pratt border table of a pattern, or of its reverse: border[j] is the length of the longest
+// proper prefix of the first j characters that is also their suffix. It is a variable template, so it is
+// computed once per pattern however many strings are searched, and every search below then takes O(n + m)
+// constant-evaluation steps where a nested loop takes O(n * m).
+template <std::size_t M>
+struct KmpTable
+{
+	std::size_t border[M + 1]{};
+};
+
+template <FixedString Pattern, bool Reversed>
+consteval KmpTable<Pattern.size()> kmp_table_logic()
+{
+	constexpr std::size_t m = Pattern.size();
+	auto				  at = [](std::size_t j) { return Pattern[Reversed ? m - 1 - j : j]; };
+
+	KmpTable<m> table{};
+	std::size_t k = 0;
+	for (std::size_t j = 1; j < m; ++j)
+	{
+		while (k > 0 && at(j) != at(k))
+			k = table.border[k];
+		if (at(j) == at(k))
+			++k;
+		table.border[j + 1] = k;
+	}
+	return table;
+}
+
+template <FixedString Pattern, bool Reversed = false>
+inline constexpr auto kmp_table = kmp_table_logic<Pattern, Reversed>();
+
+// First occurrence of a non-empty Pattern in str[start, len), or len. Reversed searches the reversed string
+// for the reversed pattern, with start and the result counted from the end of str.
+template <FixedString Pattern, bool Reversed = false, typename CharT>
+constexpr std::size_t kmp_search(const CharT* str, std::size_t len, std::size_t start)
+{
+	constexpr std::size_t m		= Pattern.size();
+	constexpr auto&		  table = kmp_table<Pattern, Reversed>;
+	auto				  pat	= [](std::size_t j) { return Pattern[Reversed ? m - 1 - j : j]; };
+
+	std::size_t k = 0;
+	for (std::size_t i = start; i < len; ++i)
+	{
+		const CharT c = str[Reversed ? len - 1 - i : i];
+		while (k > 0 && c != pat(k))
+			k = table.border[k];
+		if (c == pat(k))
+			++k;
+		if (k == m)
+			return i + 1 - m;
+	}
+	return len;
+}
+
+// Number of non-overlapping occurrences, scanning left to right, up to Limit
+template <FixedString Pattern, std::size_t Limit, typename CharT>
+constexpr std::size_t kmp_count(const CharT* str, std::size_t len)
+{
+	if constexpr (Pattern.size() == 0)
+		return 0;
+	else
+	{
+		std::size_t count = 0;
+		for (std::size_t pos = 0; count < Limit;)
+		{
+			pos = kmp_search<Pattern>(str, len, pos);
+			if (pos == len)
+				break;
+			++count;
+			pos += Pattern.size();
+		}
+		return count;
+	}
+}
+
 // === HELPER FUNCTIONS FOR SIZE CALCULATION ===
 
 template <FixedString Str>
@@ -48,92 +126,19 @@ consteval std::size_t find_first_occurrence()
 
 	if (pat_len == 0 || pat_len > str_len)
 		return str_len;
-
-	for (std::size_t i = 0; i <= str_len - pat_len; ++i)
-	{
-		bool match = true;
-		for (std::size_t j = 0; j < pat_len; ++j)
-		{
-			if (Str[i + j] != Pattern[j])
-			{
-				match = false;
-				break;
-			}
-		}
-		if (match)
-			return i;
-	}
-	return str_len;
+	return kmp_search<Pattern>(Str.data, str_len, 0);
 }
 
 template <FixedString Str, FixedString Pattern>
 consteval std::size_t count_occurrences()
 {
-	constexpr std::size_t str_len = Str.size();
-	constexpr std::size_t pat_len = Pattern.size();
-
-	if (pat_len == 0)
-		return 0;
-
-	std::size_t count = 0;
-	std::size_t pos	  = 0;
-	while (pos <= str_len - pat_len)
-	{
-		bool match = true;
-		for (std::size_t j = 0; j < pat_len; ++j)
-		{
-			if (Str[pos + j] != Pattern[j])
-			{
-				match = false;
-				break;
-			}
-		}
-		if (match)
-		{
-			++count;
-			pos += pat_len;
-		}
-		else
-		{
-			++pos;
-		}
-	}
-	return count;
+	return kmp_count<Pattern, static_cast<std::size_t>(-1)>(Str.data, Str.size());
 }
 
 template <FixedString Str, FixedString Pattern, std::size_t N>
 consteval std::size_t count_n_occurrences()
 {
-	constexpr std::size_t str_len = Str.size();
-	constexpr std::size_t pat_len = Pattern.size();
-
-	if (pat_len == 0)
-		return 0;
-
-	std::size_t count = 0;
-	std::size_t pos	  = 0;
-	while (pos <= str_len - pat_len && count < N)
-	{
-		bool match = true;
-		for (std::size_t j = 0; j < pat_len; ++j)
-		{
-			if (Str[pos + j] != Pattern[j])
-			{
-				match = false;
-				break;
-			}
-		}
-		if (match)
-		{
-			++count;
-			pos += pat_len;
-		}
-		else
-		{
-			++pos;
-		}
-	}
-	return count;
+	return kmp_count<Pattern, N>(Str.data, Str.size());
 }
 
 // === TRANSFORMATION LOGIC FUNCTIONS ===
@@ -330,102 +335,46 @@ consteval auto replace_logic()
 	return FixedString<CharT, result_len + 1>(buf, result_len);
 }
 
-template <FixedString Str, FixedString Pattern, FixedString Replacement>
-consteval auto replace_all_logic()
+// Copies Str with its first Limit non-overlapping occurrences of Pattern replaced, jumping from match to match
+template <FixedString Str, FixedString Pattern, FixedString Replacement, std::size_t Limit>
+consteval auto replace_limit_logic()
 {
 	using CharT						 = std::remove_cvref_t<decltype(Str.data[0])>;
 	constexpr std::size_t str_len	 = Str.size();
 	constexpr std::size_t pat_len	 = Pattern.size();
 	constexpr std::size_t rep_len	 = Replacement.size();
-	constexpr std::size_t count		 = count_occurrences<Str, Pattern>();
+	constexpr std::size_t count		 = count_n_occurrences<Str, Pattern, Limit>();
 	constexpr std::size_t result_len = str_len - (count * pat_len) + (count * rep_len);
 
 	CharT buf[result_len + 1]{};
 
 	std::size_t src_pos = 0;
 	std::size_t dst_pos = 0;
-
-	while (src_pos < str_len)
+	for (std::size_t replaced = 0; replaced < count; ++replaced)
 	{
-		bool match = false;
-		if (pat_len > 0 && src_pos <= str_len - pat_len)
-		{
-			match = true;
-			for (std::size_t j = 0; j < pat_len; ++j)
-			{
-				if (Str[src_pos + j] != Pattern[j])
-				{
-					match = false;
-					break;
-				}
-			}
-		}
-
-		if (match)
-		{
-			for (std::size_t i = 0; i < rep_len; ++i)
-			{
-				buf[dst_pos++] = Replacement[i];
-			}
-			src_pos += pat_len;
-		}
-		else
-		{
+		const std::size_t match = kmp_search<Pattern>(Str.data, str_len, src_pos);
+		while (src_pos < match)
 			buf[dst_pos++] = Str[src_pos++];
-		}
+		for (std::size_t i = 0; i < rep_len; ++i)
+			buf[dst_pos++] = Replacement[i];
+		src_pos += pat_len;
 	}
+	while (src_pos < str_len)
+		buf[dst_pos++] = Str[src_pos++];
 
 	return FixedString<CharT, result_len + 1>(buf, result_len);
 }
 
+template <FixedString Str, FixedString Pattern, FixedString Replacement>
+consteval auto replace_all_logic()
+{
+	return replace_limit_logic<Str, Pattern, Replacement, static_cast<std::size_t>(-1)>();
+}
+
 template <FixedString Str, FixedString Pattern, FixedString Replacement, std::size_t N>
 consteval auto replace_n_logic()
 {
-	using CharT						 = std::remove_cvref_t<decltype(Str.data[0])>;
-	constexpr std::size_t str_len	 = Str.size();
-	constexpr std::size_t pat_len	 = Pattern.size();
-	constexpr std::size_t rep_len	 = Replacement.size();
-	constexpr std::size_t count		 = count_n_occurrences<Str, Pattern, N>();
-	constexpr std::size_t result_len = str_len - (count * pat_len) + (count * rep_len);
-
-	CharT buf[result_len + 1]{};
-
-	std::size_t src_pos		 = 0;
-	std::size_t dst_pos		 = 0;
-	std::size_t replacements = 0;
-
-	while (src_pos < str_len)
-	{
-		bool match = false;
-		if (pat_len > 0 && src_pos <= str_len - pat_len && replacements < N)
-		{
-			match = true;
-			for (std::size_t j = 0; j < pat_len; ++j)
-			{
-				if (Str[src_pos + j] != Pattern[j])
-				{
-					match = false;
-					break;
-				}
-			}
-		}
-
-		if (match)
-		{
-			for (std::size_t i = 0; i < rep_len; ++i)
-			{
-				buf[dst_pos++] = Replacement[i];
-			}
-			src_pos += pat_len;
-			++replacements;
-		}
-		else
-		{
-			buf[dst_pos++] = Str[src_pos++];
-		}
-	}
-
-	return FixedString<CharT, result_len + 1>(buf, result_len);
+	return replace_limit_logic<Str, Pattern, Replacement, N>();
 }
 
 // === NON-TRANSFORMATIVE HELPERS (CONSTEVAL VALUES) ===
@@ -447,21 +396,8 @@ consteval std::size_t find()
 	if (pat_len > str_len || StartPos >= str_len)
 		return str_len;
 
-	for (std::size_t i = StartPos; i <= str_len - pat_len; ++i)
-	{
-		bool match = true;
-		for (std::size_t j = 0; j < pat_len; ++j)
-		{
-			if (Str[i + j] != Pattern[j])
-			{
-				match = false;
-				break;
-			}
-		}
-		if (match)
-			return i;
-	}
-	return static_cast<std::size_t>(-1);
+	const std::size_t pos = kmp_search<Pattern>(Str.data, str_len, StartPos);
+	return pos == str_len ? static_cast<std::size_t>(-1) : pos;
 }
 
 template <FixedString Str, auto Ch, std::size_t StartPos = 0>
@@ -486,21 +422,9 @@ consteval std::size_t rfind()
 	if (pat_len > str_len)
 		return static_cast<std::size_t>(-1);
 
-	for (std::size_t i = str_len - pat_len + 1; i > 0; --i)
-	{
-		bool match = true;
-		for (std::size_t j = 0; j < pat_len; ++j)
-		{
-			if (Str[i - 1 + j] != Pattern[j])
-			{
-				match = false;
-				break;
-			}
-		}
-		if (match)
-			return i - 1;
-	}
-	return static_cast<std::size_t>(-1);
+	// The first match of the reversed pattern in the reversed string ends where the last match starts
+	const std::size_t from_end = kmp_search<Pattern, true>(Str.data, str_len, 0);
+	return from_end == str_len ? static_cast<std::size_t>(-1) : str_len - from_end - pat_len;
 }
 
 template <FixedString Str, auto Ch>
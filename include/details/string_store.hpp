@@ -9,6 +9,15 @@ BSD-3-Clause License - See ct_str.hpp for full license text.
 #include <cstddef>
 #include <string_view>
 
+// Storage mode. value, storage and c_str() always refer to the template parameter object, the one object the
+// language guarantees per distinct value across all translation units. fwd is a copy of it by default, which
+// is emitted a second time if fwd itself is ODR-used (its address taken, or bound to a reference). Defining
+// CT_STR_SINGLE_COPY_STORAGE to 1 makes fwd a reference to the same object, so exactly one copy is ever
+// emitted; decltype(fwd) is then a const reference.
+#ifndef CT_STR_SINGLE_COPY_STORAGE
+#define CT_STR_SINGLE_COPY_STORAGE 0
+#endif
+
 namespace ct_str
 {
 
@@ -20,19 +29,13 @@ struct StringStore
 	using value_type			   = CharT;
 	static constexpr std::size_t N = sizeof(Str.data) / sizeof(CharT);
 
-	static constexpr struct Storage
-	{
-		CharT data[N];
-		consteval Storage()
-			: data{}
-		{
-			for (std::size_t i = 0; i < N; ++i)
-				data[i] = Str.data[i];
-		}
-	} storage{};
-
-	static constexpr auto						   fwd	 = Str;
-	static constexpr const CharT*				   value = storage.data;
+#if CT_STR_SINGLE_COPY_STORAGE
+	static constexpr const auto& fwd = Str;
+#else
+	static constexpr auto fwd = Str;
+#endif
+	static constexpr const auto&				   storage = Str;
+	static constexpr const CharT*				   value   = Str.data;
 	static constexpr const CharT*				   c_str() { return value; }
 	static constexpr std::basic_string_view<CharT> view() { return {value, N > 0 ? N - 1 : 0}; }
 };
@@ -0,0 +1,280 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#pragma once
+
+#include "fixed_string.hpp"
+#include "key_pack.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace ct_str
+{
+
+// === DISPATCH TABLE ===
+
+// Cases are grouped by length. Within a length, entries are sorted by a discriminator made of the characters
+// at two positions, chosen at compile time to split the group as finely as possible (usually into single
+// entries), so a lookup reads two characters, narrows to the matching entry and confirms it with word compares.
+template <typename CharT, std::size_t N, std::size_t MaxLen, std::size_t BlobSize>
+struct StringSwitchTable
+{
+	using value_type = CharT;
+	using key_type	 = std::conditional_t<sizeof(CharT) == 1, uint16_t, uint64_t>;
+
+	static constexpr key_type make_key(CharT first, CharT second)
+	{
+		using unsigned_type = std::make_unsigned_t<CharT>;
+		return static_cast<key_type>((static_cast<key_type>(static_cast<unsigned_type>(first)) << (sizeof(CharT) * 8)) |
+									 static_cast<unsigned_type>(second));
+	}
+
+	uint32_t	by_length[MaxLen + 2]{};  // entries of length L are [by_length[L], by_length[L + 1])
+	uint32_t	first_pos[MaxLen + 1]{};  // discriminating positions for each length
+	uint32_t	second_pos[MaxLen + 1]{};
+	key_type	discriminator[N]{};	 // each entry's key at those positions; sorted within a length
+	uint32_t	index[N]{};			 // case index of each entry
+	uint32_t	offset[N]{};		 // start of each entry in blob
+	CharT		blob[BlobSize + 1]{};
+	std::size_t duplicate = N;
+
+	constexpr std::size_t match(std::basic_string_view<CharT> str) const
+	{
+		const std::size_t len = str.size();
+		if (len > MaxLen)
+			return N;
+
+		uint32_t	   first = by_length[len];
+		const uint32_t last	 = by_length[len + 1];
+		if (last - first > 1)
+		{
+			// Lower bound of the discriminator. The step count depends only on the group size and the step itself
+			// is a conditional move, so runtime strings that land in different entries do not mispredict.
+			const key_type key	= make_key(str[first_pos[len]], str[second_pos[len]]);
+			uint32_t	   size = last - first;
+			while (size > 1)
+			{
+				const uint32_t half = size / 2;
+				first				= (discriminator[first + half - 1] < key) ? first + half : first;
+				size -= half;
+			}
+			first += discriminator[first] < key;
+			for (; first < last && discriminator[first] == key; ++first)
+			{
+				if (key_equal(blob + offset[first], str.data(), len))
+					return index[first];
+			}
+			return N;
+		}
+		if (first < last && key_equal(blob + offset[first], str.data(), len))
+			return index[first];
+		return N;
+	}
+};
+
+// Length of the longest run of equal keys in a sorted key array
+template <typename Key>
+constexpr std::size_t switch_largest_run(const Key* keys, std::size_t count)
+{
+	std::size_t largest = 0;
+	for (std::size_t i = 0; i < count;)
+	{
+		std::size_t j = i + 1;
+		while (j < count && keys[j] == keys[i])
+			++j;
+		largest = j - i > largest ? j - i : largest;
+		i		= j;
+	}
+	return largest;
+}
+
+template <auto... Cases>
+consteval auto string_switch_logic()
+{
+	using CharT				= typename std::remove_cvref_t<decltype(key_pack_first(Cases...))>::value_type;
+	constexpr std::size_t n = sizeof...(Cases);
+
+	constexpr bool same_char[] = {std::is_same_v<typename decltype(Cases)::value_type, CharT>...};
+	static_assert(key_pack_all(same_char), "string_switch: all cases must have the same character type");
+
+	constexpr std::size_t lengths[] = {Cases.size()...};
+	constexpr std::size_t max_len	= key_pack_max(lengths);
+	const CharT*		  data[]	= {Cases.data...};
+
+	using Table	   = StringSwitchTable<CharT, n, max_len, key_pack_total(lengths)>;
+	using key_type = typename Table::key_type;
+	Table table{};
+
+	// Group cases by length, keeping declaration order within a length (counting sort)
+	uint32_t entries[n]{};
+	for (std::size_t i = 0; i < n; ++i)
+		++table.by_length[lengths[i] + 1];
+	for (std::size_t len = 0; len <= max_len; ++len)
+		table.by_length[len + 1] += table.by_length[len];
+	uint32_t fill[max_len + 1]{};
+	for (std::size_t i = 0; i < n; ++i)
+		entries[table.by_length[lengths[i]] + fill[lengths[i]]++] = static_cast<uint32_t>(i);
+
+	key_type keys[n]{};
+	uint32_t scratch_entries[n]{};
+	key_type scratch_keys[n]{};
+	auto	 sort_by_key = [&](uint32_t first, uint32_t last, std::size_t p1, std::size_t p2)
+	{
+		for (uint32_t e = first; e < last; ++e)
+			keys[e] = Table::make_key(data[entries[e]][p1], data[entries[e]][p2]);
+
+		if constexpr (sizeof(CharT) == 1)
+		{
+			// Two-pass LSD radix sort on the key bytes
+			for (int shift = 0; shift < 16; shift += 8)
+			{
+				uint32_t starts[257]{};
+				for (uint32_t e = first; e < last; ++e)
+					++starts[((keys[e] >> shift) & 0xFF) + 1];
+				for (int b = 0; b < 256; ++b)
+					starts[b + 1] += starts[b];
+				for (uint32_t e = first; e < last; ++e)
+				{
+					const uint32_t to = first + starts[(keys[e] >> shift) & 0xFF]++;
+					scratch_entries[to] = entries[e];
+					scratch_keys[to]	= keys[e];
+				}
+				for (uint32_t e = first; e < last; ++e)
+				{
+					entries[e] = scratch_entries[e];
+					keys[e]	   = scratch_keys[e];
+				}
+			}
+		}
+		else
+		{
+			// Insertion sort
+			for (uint32_t e = first + 1; e < last; ++e)
+			{
+				const uint32_t entry = entries[e];
+				const key_type key	 = keys[e];
+				uint32_t	   f	 = e;
+				for (; f > first && keys[f - 1] > key; --f)
+				{
+					entries[f] = entries[f - 1];
+					keys[f]	   = keys[f - 1];
+				}
+				entries[f] = entry;
+				keys[f]	   = key;
+			}
+		}
+		return switch_largest_run(keys + first, last - first);
+	};
+
+	for (std::size_t len = 1; len <= max_len; ++len)
+	{
+		const uint32_t first = table.by_length[len];
+		const uint32_t last	 = table.by_length[len + 1];
+		if (last - first < 2)
+			continue;
+
+		// Greedily pick the position that leaves the smallest largest group, then the partner position
+		std::size_t p1 = 0, best = n + 1;
+		for (std::size_t pos = 0; pos < len && best > 1; ++pos)
+		{
+			const std::size_t group = sort_by_key(first, last, pos, pos);
+			if (group < best)
+			{
+				best = group;
+				p1	 = pos;
+			}
+		}
+		std::size_t p2 = p1;
+		for (std::size_t pos = 0; pos < len && best > 1; ++pos)
+		{
+			const std::size_t group = (pos == p1) ? best : sort_by_key(first, last, p1, pos);
+			if (group < best)
+			{
+				best = group;
+				p2	 = pos;
+			}
+		}
+		table.first_pos[len]  = static_cast<uint32_t>(p1);
+		table.second_pos[len] = static_cast<uint32_t>(p2);
+		sort_by_key(first, last, p1, p2);
+
+		// Equal cases share a key, so after sorting they sit in the same run
+		for (uint32_t e = first; e < last; ++e)
+		{
+			for (uint32_t f = e + 1; f < last && keys[f] == keys[e]; ++f)
+			{
+				if (key_equal(data[entries[e]], data[entries[f]], len))
+				{
+					table.duplicate = entries[f];
+					return table;
+				}
+			}
+		}
+	}
+
+	// Two empty cases are the only duplicates the loop above cannot see
+	if (table.by_length[1] - table.by_length[0] > 1)
+	{
+		table.duplicate = entries[1];
+		return table;
+	}
+
+	// Lay the entries out in dispatch order
+	std::size_t pos = 0;
+	for (std::size_t e = 0; e < n; ++e)
+	{
+		const uint32_t i		= entries[e];
+		table.index[e]			= i;
+		table.offset[e]			= static_cast<uint32_t>(pos);
+		table.discriminator[e]	= keys[e];
+		for (std::size_t j = 0; j < lengths[i]; ++j)
+			table.blob[pos++] = data[i][j];
+	}
+	return table;
+}
+
+// === STRING SWITCH ===
+
+// Dispatch of runtime strings against a fixed case list. match() returns the index of the matching case in
+// the template argument list, or the number of cases (no_match) when none matches.
+template <FixedString... Cases>
+struct StringSwitch
+{
+	static_assert(sizeof...(Cases) > 0, "string_switch: at least one case is required");
+
+	static constexpr auto table = string_switch_logic<Cases...>();
+	static_assert(table.duplicate == sizeof...(Cases), "string_switch: duplicate case");
+
+	using CharT		 = typename decltype(table)::value_type;
+	using value_type = CharT;
+
+	static constexpr std::size_t no_match = sizeof...(Cases);
+
+	static constexpr std::size_t match(std::basic_string_view<CharT> str) { return table.match(str); }
+
+	// Index of a case, for use as a case label; a string outside the list is a compile error
+	template <FixedString Case>
+	static consteval std::size_t index_of()
+	{
+		constexpr std::size_t index = table.match(std::basic_string_view<CharT>(Case.data, Case.size()));
+		static_assert(index != no_match, "string_switch::index_of: not one of the cases");
+		return index;
+	}
+};
+
+//	switch (ct_str::string_switch<"GET", "PUT", "DELETE">(method))
+//	{
+//	case 0: ...		// GET
+//	case 3: ...		// no match
+//	}
+template <FixedString... Cases>
+constexpr std::size_t string_switch(std::basic_string_view<typename StringSwitch<Cases...>::CharT> str)
+{
+	return StringSwitch<Cases...>::match(str);
+}
+
+}  // namespace ct_str
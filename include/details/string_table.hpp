@@ -0,0 +1,203 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#pragma once
+
+#include "fixed_string.hpp"
+#include "key_pack.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace ct_str
+{
+
+// === STRING TABLE ===
+
+struct StringTableEntry
+{
+	uint32_t offset = 0;
+	uint32_t length = 0;
+};
+
+// All strings in one array, each followed by a terminator, indexed by 32-bit offsets and lengths. Unlike an
+// array of pointers, nothing in the table holds an address, so a position-independent binary needs no
+// relocation to load it and the whole table stays in read-only, shareable pages.
+template <typename CharT, std::size_t N, std::size_t BlobSize>
+struct StringTableData
+{
+	using value_type = CharT;
+	using Entry		 = StringTableEntry;
+
+	CharT blob[BlobSize]{};
+	Entry entries[N]{};
+};
+
+// === TAIL MERGING ===
+
+template <typename CharT>
+constexpr bool tail_less(const CharT* a, std::size_t la, const CharT* b, std::size_t lb)
+{
+	for (std::size_t k = 0; k < la && k < lb; ++k)
+	{
+		if (a[la - 1 - k] != b[lb - 1 - k])
+			return a[la - 1 - k] < b[lb - 1 - k];
+	}
+	return la < lb;
+}
+
+template <typename CharT>
+constexpr bool is_tail_of(const CharT* a, std::size_t la, const CharT* b, std::size_t lb)
+{
+	if (la > lb)
+		return false;
+	for (std::size_t k = 0; k < la; ++k)
+	{
+		if (a[la - 1 - k] != b[lb - 1 - k])
+			return false;
+	}
+	return true;
+}
+
+// Places each string in a blob where strings that end another string share its tail, as linkers merge
+// .rodata.str sections: sorted by reversed content, a string that is a suffix of any other is a suffix of the
+// string right after it, so one backward pass finds every host. Fills entries and returns the blob size.
+template <typename CharT, std::size_t N>
+consteval std::size_t tail_merge_layout(const CharT* const (&data)[N], const std::size_t (&lengths)[N],
+										StringTableEntry (&entries)[N])
+{
+	std::size_t order[N]{};
+	for (std::size_t i = 0; i < N; ++i)
+		order[i] = i;
+	std::sort(order, order + N, [&](std::size_t a, std::size_t b)
+			  { return tail_less(data[a], lengths[a], data[b], lengths[b]); });
+
+	std::size_t pos = 0;
+	for (std::size_t k = N; k-- > 0;)
+	{
+		const std::size_t i = order[k];
+		entries[i].length	= static_cast<uint32_t>(lengths[i]);
+		if (k + 1 < N && is_tail_of(data[i], lengths[i], data[order[k + 1]], lengths[order[k + 1]]))
+		{
+			const StringTableEntry& host = entries[order[k + 1]];
+			entries[i].offset			 = static_cast<uint32_t>(host.offset + host.length - lengths[i]);
+		}
+		else
+		{
+			entries[i].offset = static_cast<uint32_t>(pos);
+			pos += lengths[i] + 1;
+		}
+	}
+	return pos;
+}
+
+template <auto... Strs>
+consteval std::size_t tail_merged_size()
+{
+	using CharT = typename std::remove_cvref_t<decltype(key_pack_first(Strs...))>::value_type;
+
+	const CharT*	  data[]	= {Strs.data...};
+	const std::size_t lengths[] = {Strs.size()...};
+	StringTableEntry  entries[sizeof...(Strs)]{};
+	return tail_merge_layout(data, lengths, entries);
+}
+
+template <bool TailMerge, auto... Strs>
+consteval auto string_table_logic()
+{
+	using CharT				= typename std::remove_cvref_t<decltype(key_pack_first(Strs...))>::value_type;
+	constexpr std::size_t n = sizeof...(Strs);
+
+	constexpr bool same_char[] = {std::is_same_v<typename decltype(Strs)::value_type, CharT>...};
+	static_assert(key_pack_all(same_char), "string_table: all strings must have the same character type");
+
+	constexpr std::size_t lengths[] = {Strs.size()...};
+	constexpr std::size_t blob_size = TailMerge ? tail_merged_size<Strs...>() : key_pack_total(lengths) + n;
+	static_assert(blob_size <= UINT32_MAX, "string_table: strings exceed 32-bit offsets");
+	const CharT* data[] = {Strs.data...};
+
+	StringTableData<CharT, n, blob_size> table{};
+	if constexpr (TailMerge)
+		tail_merge_layout(data, lengths, table.entries);
+	else
+	{
+		uint32_t pos = 0;
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			table.entries[i] = {pos, static_cast<uint32_t>(lengths[i])};
+			pos += static_cast<uint32_t>(lengths[i] + 1);
+		}
+	}
+	// A tail shared by several strings is written once per string, always with the same bytes
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		for (std::size_t j = 0; j < lengths[i]; ++j)
+			table.blob[table.entries[i].offset + j] = data[i][j];
+	}
+	return table;
+}
+
+template <bool TailMerge, FixedString... Strs>
+struct basic_string_table
+{
+	static_assert(sizeof...(Strs) > 0, "string_table: at least one string is required");
+
+	static constexpr auto table = string_table_logic<TailMerge, Strs...>();
+
+	using CharT		 = typename decltype(table)::value_type;
+	using value_type = CharT;
+
+	static constexpr std::size_t size() { return sizeof...(Strs); }
+
+	static constexpr std::basic_string_view<CharT> view(std::size_t index)
+	{
+		return {table.blob + table.entries[index].offset, table.entries[index].length};
+	}
+
+	static constexpr const CharT* c_str(std::size_t index) { return table.blob + table.entries[index].offset; }
+	static constexpr std::size_t  length(std::size_t index) { return table.entries[index].length; }
+
+	// The blob itself: every string (or shared tail) with its terminator
+	static constexpr const CharT* data() { return table.blob; }
+	static constexpr std::size_t  blob_size() { return sizeof(table.blob) / sizeof(CharT); }
+
+	// Position of a string known at compile time (the first, if it is listed more than once)
+	template <FixedString Str>
+	static consteval std::size_t index_of()
+	{
+		constexpr std::size_t index = []
+		{
+			const std::basic_string_view<CharT> key(Str.data, Str.size());
+			for (std::size_t i = 0; i < sizeof...(Strs); ++i)
+			{
+				if (view(i) == key)
+					return i;
+			}
+			return sizeof...(Strs);
+		}();
+		static_assert(index != sizeof...(Strs), "string_table::index_of: string is not in the table");
+		return index;
+	}
+};
+
+// A fixed list of strings stored as one blob. Strings are addressed by their position in the template
+// argument list; view() and c_str() compute the address from the blob and an offset at runtime.
+//
+//	using Messages = ct_str::string_table<"ok", "not found", "timeout">;
+//	std::string_view text = Messages::view(status);
+template <FixedString... Strs>
+using string_table = basic_string_table<false, Strs...>;
+
+// A string_table whose strings share storage with any string they end, so "error", "io_error" and
+// "disk_io_error" take 14 characters instead of 29. Strings keep their terminators and declaration order.
+//
+//	using Errors = ct_str::suffix_table<"error", "io_error", "disk_io_error">;
+//	const char* text = Errors::c_str(1);
+template <FixedString... Strs>
+using suffix_table = basic_string_table<true, Strs...>;
+
+}  // namespace ct_str
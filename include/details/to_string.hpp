@@ -0,0 +1,150 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#pragma once
+
+#include "fixed_string.hpp"
+#include "float_fns.hpp"
+#include "number_fns.hpp"
+#include "string_store.hpp"
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+
+namespace ct_str
+{
+
+// === NUMBER OUTPUT ===
+
+template <typename T>
+inline constexpr bool is_number_v =
+	(std::is_integral_v<T> && !std::is_same_v<T, bool>) || std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+// Longest unpadded text of a T written by write_number in Base
+template <typename T, unsigned Base>
+consteval std::size_t number_max_length()
+{
+	if constexpr (std::is_floating_point_v<T>)
+		return shortest_max_length<T>;
+	else
+		return number_length<Base>(std::numeric_limits<std::make_unsigned_t<T>>::max()) + std::is_signed_v<T>;
+}
+
+// Integers go to write_integer. Floating-point values are written shortest-first, then padded by the same rules
+// when width asks for more.
+template <unsigned Base, typename T>
+constexpr char* write_number(char* out, T value, std::size_t width, char fill)
+{
+	if constexpr (std::is_floating_point_v<T>)
+	{
+		if (width == 0)
+			return write_shortest(out, value);
+		char			  text[shortest_max_length<T>]{};
+		const std::size_t len	   = static_cast<std::size_t>(write_shortest(text, value) - text);
+		const bool		  negative = text[0] == '-';
+		std::size_t		  i		   = 0;
+		if (negative && fill == '0')
+			*out++ = text[i++];
+		for (std::size_t pad = width > len ? width - len : 0; pad > 0; --pad)
+			*out++ = fill;
+		for (; i < len; ++i)
+			*out++ = text[i];
+		return out;
+	}
+	else
+		return write_integer<Base>(out, value, width, fill);
+}
+
+// === TO_STRING ===
+
+template <auto Value, unsigned Base, std::size_t Width, char Fill>
+consteval auto to_string_logic()
+{
+	using T = decltype(Value);
+	static_assert(is_number_v<T>, "to_string: Value must be an integer, float or double");
+	static_assert(Base >= 2 && Base <= 36, "to_string: Base must be between 2 and 36");
+	static_assert(std::is_integral_v<T> || Base == 10, "to_string: floating-point values are written in base 10");
+
+	constexpr auto len = []
+	{
+		char buf[number_max_length<T, Base>() + Width]{};
+		return static_cast<std::size_t>(write_number<Base>(buf, Value, Width, Fill) - buf);
+	}();
+	char text[len + 1]{};
+	write_number<Base>(text, Value, Width, Fill);
+	return FixedString<char, len + 1>(text, len);
+}
+
+// A numeric constant as text, left-padded with Fill to at least Width characters. Integers are written in Base
+// (2 to 36, lowercase digits); float and double values get the shortest digits that read back as the same value,
+// exactly as std::to_chars writes them. Writes with the same tables and rules as rt::to_chars:
+//
+//	using port = ct_str::to_string<8080>;					// "8080"
+//	using id   = ct_str::to_string<ct_str::crc32<"boot">(), 16, 8>;	// eight hex digits
+//	using gain = ct_str::to_string<0.1>;					// "0.1"
+template <auto Value, unsigned Base = 10, std::size_t Width = 0, char Fill = '0'>
+using to_string = StringStore<to_string_logic<Value, Base, Width, Fill>()>;
+
+template <auto Value, std::size_t Precision>
+consteval auto to_fixed_logic()
+{
+	using T = decltype(Value);
+	static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>, "to_fixed: Value must be a float or double");
+
+	constexpr auto len = []
+	{
+		char buf[fixed_max_length<T>(Precision)]{};
+		return static_cast<std::size_t>(write_fixed(buf, Value, Precision) - buf);
+	}();
+	char text[len + 1]{};
+	write_fixed(text, Value, Precision);
+	return FixedString<char, len + 1>(text, len);
+}
+
+// A float or double constant with Precision digits after the point, as printf("%.*f") writes it: the exact
+// binary value rounded to nearest, ties to even.
+//
+//	using threshold = ct_str::to_fixed<0.125, 2>;	// "0.12"
+template <auto Value, std::size_t Precision = 6>
+using to_fixed = StringStore<to_fixed_logic<Value, Precision>()>;
+
+namespace rt
+{
+
+// Buffer size that holds the unpadded text of any T in Base
+template <typename T, unsigned Base = 10>
+inline constexpr std::size_t to_chars_max = number_max_length<T, Base>();
+
+// Runtime counterpart of ct_str::to_string, producing the same text. out has room for
+// max(width, to_chars_max<T, Base>) characters; returns the end, with no terminator written.
+template <unsigned Base = 10, typename T>
+inline char* to_chars(char* out, T value, std::size_t width = 0, char fill = '0')
+{
+	static_assert(is_number_v<T>, "to_chars: integer, float or double required");
+	static_assert(Base >= 2 && Base <= 36, "to_chars: Base must be between 2 and 36");
+	static_assert(std::is_integral_v<T> || Base == 10, "to_chars: floating-point values are written in base 10");
+	return write_number<Base>(out, value, width, fill);
+}
+
+// to_chars into an array, returning the text. A width larger than the array is cut down to fit.
+template <unsigned Base = 10, std::size_t N, typename T>
+inline std::string_view to_string(char (&buf)[N], T value, std::size_t width = 0, char fill = '0')
+{
+	static_assert(N >= to_chars_max<T, Base>, "to_string: buffer too small for this type");
+	const char* end = to_chars<Base>(buf, value, width < N ? width : N, fill);
+	return std::string_view(buf, static_cast<std::size_t>(end - buf));
+}
+
+// Runtime counterpart of ct_str::to_fixed. out has room for fixed_max_length<T>(precision) characters.
+template <typename T>
+inline char* to_chars_fixed(char* out, T value, std::size_t precision)
+{
+	static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>, "to_chars_fixed: float or double required");
+	return write_fixed(out, value, precision);
+}
+
+}  // namespace rt
+
+}  // namespace ct_str
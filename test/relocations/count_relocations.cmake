@@ -0,0 +1,26 @@
+# Counts R_X86_64_RELATIVE relocations in the pointer-table and string_table libraries and checks that the
+# string_table version avoids the one-per-string relocations of the pointer table.
+#
+# Expects READELF, POINTERS, TABLE and COUNT (the number of strings in each library).
+
+function(count_relative library out)
+	execute_process(COMMAND ${READELF} -r -W ${library} OUTPUT_VARIABLE relocs RESULT_VARIABLE result)
+	if(NOT result EQUAL 0)
+		message(FATAL_ERROR "readelf failed on ${library}")
+	endif()
+	string(REGEX MATCHALL "R_X86_64_RELATIVE" matches "${relocs}")
+	list(LENGTH matches count)
+	set(${out} ${count} PARENT_SCOPE)
+endfunction()
+
+count_relative(${POINTERS} before)
+count_relative(${TABLE} after)
+message(STATUS "R_X86_64_RELATIVE relocations for ${COUNT} strings: pointer table ${before}, string_table ${after}")
+
+math(EXPR saved "${before} - ${after}")
+if(before LESS COUNT)
+	message(FATAL_ERROR "expected at least ${COUNT} relocations in the pointer table, found ${before}")
+endif()
+if(saved LESS COUNT)
+	message(FATAL_ERROR "string_table saved only ${saved} relocations, expected at least ${COUNT}")
+endif()
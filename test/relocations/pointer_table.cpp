@@ -0,0 +1,21 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+// Baseline: an array of pointers to StringStore values, one dynamic relocation per entry
+
+#include "ct_str.hpp"
+#include "reloc_strings.hpp"
+#include <cstddef>
+
+template <ct_str::FixedString... Strs>
+struct PointerTable
+{
+	static constexpr const char* names[] = {ct_str::StringStore<Strs>::value...};
+};
+
+extern "C" __attribute__((visibility("default"))) const char* reloc_name(std::size_t index)
+{
+	return PointerTable<RELOC_STRINGS>::names[index];
+}
@@ -0,0 +1,20 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#pragma once
+
+// 1000 distinct strings, "msg_000" ... "msg_999"
+#define RELOC_STR(x) RELOC_STR_(x)
+#define RELOC_STR_(x) #x
+#define RELOC_KEYS_10(p)                                                                                           \
+	RELOC_STR(p##0), RELOC_STR(p##1), RELOC_STR(p##2), RELOC_STR(p##3), RELOC_STR(p##4), RELOC_STR(p##5),         \
+		RELOC_STR(p##6), RELOC_STR(p##7), RELOC_STR(p##8), RELOC_STR(p##9)
+#define RELOC_KEYS_100(p)                                                                                          \
+	RELOC_KEYS_10(p##0), RELOC_KEYS_10(p##1), RELOC_KEYS_10(p##2), RELOC_KEYS_10(p##3), RELOC_KEYS_10(p##4),      \
+		RELOC_KEYS_10(p##5), RELOC_KEYS_10(p##6), RELOC_KEYS_10(p##7), RELOC_KEYS_10(p##8), RELOC_KEYS_10(p##9)
+#define RELOC_STRINGS                                                                                              \
+	RELOC_KEYS_100(msg_0), RELOC_KEYS_100(msg_1), RELOC_KEYS_100(msg_2), RELOC_KEYS_100(msg_3),                   \
+		RELOC_KEYS_100(msg_4), RELOC_KEYS_100(msg_5), RELOC_KEYS_100(msg_6), RELOC_KEYS_100(msg_7),               \
+		RELOC_KEYS_100(msg_8), RELOC_KEYS_100(msg_9)
@@ -0,0 +1,15 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+// The same strings through string_table: one blob plus an offset index, no relocations
+
+#include "ct_str.hpp"
+#include "reloc_strings.hpp"
+#include <cstddef>
+
+extern "C" __attribute__((visibility("default"))) const char* reloc_name(std::size_t index)
+{
+	return ct_str::string_table<RELOC_STRINGS>::c_str(index);
+}
@@ -0,0 +1,117 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#include <cstddef>
+#include <ostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "doctest.h"
+#include "ct_str.hpp"
+
+namespace
+{
+
+using Match = std::pair<std::size_t, std::size_t>;
+
+template <typename Automaton>
+std::vector<Match> scan_all(std::string_view text)
+{
+	std::vector<Match> matches;
+	Automaton::scan(text, [&](std::size_t pattern, std::size_t offset) { matches.emplace_back(pattern, offset); });
+	return matches;
+}
+
+// Every occurrence of every pattern, ordered by end position and then by decreasing length, as scan reports them
+template <typename Automaton>
+std::vector<Match> naive_all(std::string_view text)
+{
+	std::vector<Match> matches;
+	for (std::size_t end = 1; end <= text.size(); ++end)
+	{
+		for (std::size_t len = end; len > 0; --len)
+		{
+			for (std::size_t p = 0; p < Automaton::size(); ++p)
+			{
+				if (Automaton::pattern(p).size() == len && text.substr(end - len, len) == Automaton::pattern(p))
+					matches.emplace_back(p, end - len);
+			}
+		}
+	}
+	return matches;
+}
+
+template <typename Automaton>
+constexpr std::size_t count_matches(std::string_view text)
+{
+	std::size_t count = 0;
+	Automaton::scan(text, [&](std::size_t, std::size_t) { ++count; });
+	return count;
+}
+
+}  // namespace
+
+TEST_SUITE("Aho-Corasick")
+{
+	TEST_CASE("Reports overlapping matches with pattern index and start offset")
+	{
+		using Words = ct_str::aho_corasick<"he", "she", "his", "hers">;
+		static_assert(Words::size() == 4);
+		static_assert(Words::pattern(3) == "hers");
+
+		// "ushers": she ends at 3, he ends at 3, hers ends at 5
+		const auto matches = scan_all<Words>("ushers");
+		REQUIRE(matches.size() == 3);
+		CHECK(matches[0] == Match{1, 1});
+		CHECK(matches[1] == Match{0, 2});
+		CHECK(matches[2] == Match{3, 2});
+
+		CHECK(scan_all<Words>("").empty());
+		CHECK(scan_all<Words>("xyz").empty());
+		CHECK(scan_all<Words>("hhhhis") == std::vector<Match>{{2, 3}});
+	}
+
+	TEST_CASE("Scans at compile time")
+	{
+		using Words = ct_str::aho_corasick<"he", "she", "his", "hers">;
+		static_assert(count_matches<Words>("ushers") == 3);
+		static_assert(count_matches<Words>("nothing here") == 1);
+		static_assert(count_matches<Words>("abc") == 0);
+	}
+
+	TEST_CASE("Patterns that are prefixes, suffixes and repeats of each other")
+	{
+		using Nested = ct_str::aho_corasick<"a", "aa", "aaa", "ba", "aab">;
+		const std::string text = "aaabaab";
+		CHECK(scan_all<Nested>(text) == naive_all<Nested>(text));
+		CHECK(count_matches<Nested>("aaaa") == 4 + 3 + 2);
+	}
+
+	TEST_CASE("Single and binary patterns")
+	{
+		using One = ct_str::aho_corasick<"needle">;
+		CHECK(scan_all<One>("haystack needle hay needleneedle") == std::vector<Match>{{0, 9}, {0, 20}, {0, 26}});
+
+		using Binary = ct_str::aho_corasick<"\x00\xff", "\xff\xff">;
+		const std::string text("\x00\xff\xff\xff\x00", 5);
+		CHECK(scan_all<Binary>(text) == std::vector<Match>{{0, 0}, {1, 1}, {1, 2}});
+	}
+
+	TEST_CASE("Agrees with a naive search on random text")
+	{
+		using Signatures = ct_str::aho_corasick<"ab", "abc", "bca", "cab", "aaa", "c", "bb", "abcabc", "cc", "acb">;
+
+		std::mt19937 rng(42);
+		std::string	 text(4096, ' ');
+		for (auto& c : text)
+			c = static_cast<char>('a' + rng() % 3);
+
+		const auto matches = scan_all<Signatures>(text);
+		CHECK(matches.size() > 1000);
+		CHECK(matches == naive_all<Signatures>(text));
+	}
+}
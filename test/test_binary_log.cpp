@@ -0,0 +1,303 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <set>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include "doctest.h"
+#include "details/binary_log.hpp"
+
+namespace
+{
+
+std::string read_file(const std::string& path)
+{
+	std::ifstream in(path, std::ios::binary);
+	return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+// The arguments as log() would store them
+template <typename... Args>
+std::string encode(const Args&... args)
+{
+	std::string out((std::size_t{0} + ... + ct_str::binlog::arg_size(args)), '\0');
+	[[maybe_unused]] auto* pos = reinterpret_cast<std::byte*>(out.data());
+	((pos = ct_str::binlog::encode_arg(pos, args)), ...);
+	return out;
+}
+
+template <ct_str::FixedString Fmt, typename... Args>
+std::string render(const Args&... args)
+{
+	using Def = ct_str::binlog::Message<Fmt, std::decay_t<Args>...>;
+	std::string out;
+	ct_str::binlog::render(out, {std::string(Def::text::view()), std::string(Def::layout::view())}, encode(args...));
+	return out;
+}
+
+}  // namespace
+
+TEST_SUITE("Binary Logging")
+{
+	TEST_CASE("Message layouts and IDs")
+	{
+		using ct_str::binlog::Message;
+		static_assert(Message<"{}", bool>::layout::view() == "b");
+		static_assert(Message<"{} {} {} {}", char, int16_t, uint32_t, int64_t>::layout::view() == "csIl");
+		static_assert(Message<"{} {} {}", float, double, const char*>::layout::view() == "fdz");
+		static_assert(Message<"no arguments">::layout::view().empty());
+
+		// The ID covers the text and the layout
+		static_assert(Message<"{}", int>::id == Message<"{}", int>::id);
+		static_assert(Message<"{}", int>::id != Message<"{}", long long>::id);
+		static_assert(Message<"a {}", int>::id != Message<"b {}", int>::id);
+		static_assert(Message<"{}", int>::id != 0);
+	}
+
+	TEST_CASE("Rendering matches ct_str::format")
+	{
+		CHECK(render<"plain text">() == "plain text");
+		CHECK(render<"{} + {} = {}">(2, 3u, int64_t{5}) == "2 + 3 = 5");
+		CHECK(render<"min {} max {}">(INT64_MIN, UINT64_MAX) == "min -9223372036854775808 max 18446744073709551615");
+		CHECK(render<"hex {:x} dec {:d}">(uint32_t{0xbeef}, int16_t{-42}) == "hex beef dec -42");
+		CHECK(render<"{} {:s} {:c}">(true, false, 'q') == "true false q");
+		CHECK(render<"{} {}">(0.1, 1.5f) == "0.1 1.5");
+		CHECK(render<"name={} path={:s}">("alpha", std::string("/tmp/x")) == "name=alpha path=/tmp/x");
+		CHECK(render<"{{{}}}">(std::string_view("")) == "{}");
+
+		char		buf[128];
+		const auto	expected = ct_str::format<"{} {:x} {} {:s} {}">::format_to(buf, -7, 255u, 2.5, true, "s");
+		CHECK(render<"{} {:x} {} {:s} {}">(-7, 255u, 2.5, true, "s") == expected);
+	}
+
+	TEST_CASE("Rendering flags records that do not match their layout")
+	{
+		std::string out;
+		ct_str::binlog::render(out, {"{} {}", "ii"}, encode(int32_t{1}));
+		CHECK(out.ends_with("<bad record>"));
+		out.clear();
+		ct_str::binlog::render(out, {"{}", "i"}, encode(int32_t{1}, int32_t{2}));
+		CHECK(out == "1<bad record>");
+		out.clear();
+		ct_str::binlog::render(out, {"{}", "z"}, std::string("\x09\0\0\0abc", 7));
+		CHECK(out.ends_with("<bad record>"));
+	}
+
+	TEST_CASE("Ring wraps, pads and drops")
+	{
+		ct_str::binlog::Ring ring(4096, 7);
+		std::vector<uint32_t> seen;
+		auto drain = [&]
+		{
+			return ring.drain(
+				[&](const std::byte* data, std::size_t size)
+				{
+					for (std::size_t pos = 0; pos < size;)
+					{
+						ct_str::binlog::RecordHeader header;
+						ct_str::binlog::copy_bytes(&header, data + pos, sizeof(header));
+						REQUIRE(header.id != 0);
+						seen.push_back(header.id);
+						pos += ct_str::binlog::record_bytes(header.size);
+					}
+				});
+		};
+		auto push = [&](uint32_t id, std::size_t payload)
+		{
+			const std::size_t bytes = ct_str::binlog::record_bytes(payload);
+			std::byte*		  out	= ring.reserve(bytes);
+			if (out == nullptr)
+			{
+				ring.drop();
+				return false;
+			}
+			const ct_str::binlog::RecordHeader header{id, static_cast<uint32_t>(payload), id};
+			ct_str::binlog::copy_bytes(out, &header, sizeof(header));
+			ring.commit(bytes);
+			return true;
+		};
+
+		// 1000-byte records: four fit, the fifth is dropped
+		uint32_t id = 1;
+		for (; id <= 4; ++id)
+			CHECK(push(id, 1000 - sizeof(ct_str::binlog::RecordHeader)));
+		CHECK_FALSE(push(99, 1000 - sizeof(ct_str::binlog::RecordHeader)));
+		CHECK(ring.dropped() == 1);
+		CHECK(ring.take_new_drops() == 1);
+		CHECK(ring.take_new_drops() == 0);
+
+		// Freeing them lets the next records wrap past the 96 bytes left at the end
+		CHECK(drain() == 4000);
+		CHECK(ring.empty());
+		for (; id <= 40; ++id)
+		{
+			REQUIRE(push(id, 200));
+			if (id % 8 == 0)
+				drain();
+		}
+		drain();
+		REQUIRE(seen.size() == 40);
+		for (uint32_t i = 0; i < 40; ++i)
+			CHECK(seen[i] == i + 1);
+		CHECK(ring.thread_index() == 7);
+
+		// 169 records of 24 bytes and two of 16 leave 8 bytes at the end: room for the padding ID, not a header
+		ct_str::binlog::Ring tail_ring(4096, 0);
+		std::size_t			 drained = 0;
+		auto				 drain_tail = [&]
+		{
+			return tail_ring.drain([&](const std::byte*, std::size_t size) { drained += size; });
+		};
+		auto push_tail = [&](std::size_t payload)
+		{
+			const std::size_t bytes = ct_str::binlog::record_bytes(payload);
+			std::byte*		  out	= tail_ring.reserve(bytes);
+			if (out == nullptr)
+				return false;
+			const ct_str::binlog::RecordHeader header{1, static_cast<uint32_t>(payload), 0};
+			ct_str::binlog::copy_bytes(out, &header, sizeof(header));
+			tail_ring.commit(bytes);
+			return true;
+		};
+		for (int i = 0; i < 169; ++i)
+			REQUIRE(push_tail(8));
+		REQUIRE(push_tail(0));
+		REQUIRE(push_tail(0));
+		CHECK(drain_tail() == 4088);
+		REQUIRE(push_tail(8));
+		CHECK(drain_tail() == 8 + 24);
+		CHECK(drained == 4088 + 24);
+		CHECK(tail_ring.empty());
+	}
+
+	TEST_CASE("Logger writes a file the reader decodes")
+	{
+		const std::string path = "ct_str_test_binary_log.ctlog";
+		auto&			  logger = ct_str::binlog::Logger::instance();
+		REQUIRE(logger.start(path));
+		CHECK_FALSE(logger.start(path));
+
+		constexpr int per_thread = 500;
+		auto		  work		 = [](int thread)
+		{
+			for (int i = 0; i < per_thread; ++i)
+				ct_str::binlog::log<"thread {} item {} of {:s}">(thread, i, std::string_view("work"));
+			ct_str::binlog::log<"thread {} done, ratio {}">(thread, thread / 4.0);
+		};
+		std::thread first(work, 1);
+		std::thread second(work, 2);
+		first.join();
+		second.join();
+		logger.stop();
+		CHECK_FALSE(logger.running());
+
+		ct_str::binlog::LogReader reader;
+		const bool parsed = reader.parse(read_file(path));
+		CHECK(reader.error() == "");
+		REQUIRE(parsed);
+		std::remove(path.c_str());
+
+		CHECK(reader.dropped() == 0);
+		REQUIRE(reader.records().size() == 2 * (per_thread + 1));
+		CHECK(reader.header().ticks_per_second > 0);
+
+		std::set<std::string> lines;
+		std::set<uint32_t>	  threads;
+		uint64_t			  last = 0;
+		for (const auto& record : reader.records())
+		{
+			CHECK(record.time >= last);
+			CHECK(reader.seconds(record) >= 0.0);
+			last = record.time;
+			threads.insert(record.thread);
+			lines.insert(reader.text(record));
+		}
+		CHECK(threads.size() == 2);
+		CHECK(lines.size() == reader.records().size());
+		CHECK(lines.count("thread 1 item 0 of work") == 1);
+		CHECK(lines.count("thread 2 item 499 of work") == 1);
+		CHECK(lines.count("thread 1 done, ratio 0.25") == 1);
+		CHECK(lines.count("thread 2 done, ratio 0.5") == 1);
+
+		// Per thread, records keep their order
+		std::vector<int> next(3, 0);
+		for (const auto& record : reader.records())
+		{
+			const std::string text = reader.text(record);
+			if (text.find(" item ") == std::string::npos)
+				continue;
+			const int thread = text[7] - '0';
+			CHECK(text == "thread " + std::to_string(thread) + " item " + std::to_string(next[thread]++) + " of work");
+		}
+	}
+
+	TEST_CASE("Reader rejects damaged files")
+	{
+		ct_str::binlog::LogReader reader;
+		CHECK_FALSE(reader.parse("short"));
+		CHECK_FALSE(reader.parse(std::string(sizeof(ct_str::binlog::FileHeader), 'x')));
+		CHECK(reader.error() == "not a ct_str binary log");
+
+		const ct_str::binlog::FileHeader header;
+		std::string						 data(reinterpret_cast<const char*>(&header), sizeof(header));
+		CHECK(reader.parse(data));
+		CHECK(reader.records().empty());
+
+		const ct_str::binlog::ChunkHeader chunk{ct_str::binlog::ChunkKind::records, 0, 64};
+		data.append(reinterpret_cast<const char*>(&chunk), sizeof(chunk));
+		data.append(10, '\0');
+		CHECK_FALSE(reader.parse(data));
+		CHECK(reader.error() == "truncated chunk");
+
+		ct_str::binlog::LogRecord record{0, 0, 0x1234, {}};
+		CHECK(reader.text(record) == "<unknown message 0x00001234>");
+	}
+
+	TEST_CASE("Messages that share an ID are reported")
+	{
+		// The second text was chosen so that the two crc32s match
+		using First	 = ct_str::binlog::Message<"collision check: first">;
+		using Second = ct_str::binlog::Message<"collision check: second 5 ZOCh">;
+		static_assert(First::id == Second::id);
+		static_assert(First::id == 0x712ee0c4);
+		CHECK(First::node.id == Second::node.id);
+
+		const std::vector<uint32_t> ids = ct_str::binlog::colliding_message_ids();
+		CHECK(std::count(ids.begin(), ids.end(), First::id) == 1);
+
+		// A file whose message table has both, and one record with their ID
+		const ct_str::binlog::FileHeader header;
+		std::string						 data(reinterpret_cast<const char*>(&header), sizeof(header));
+		std::string						 table;
+		for (const std::string_view text : {First::text::view(), Second::text::view(), First::text::view()})
+		{
+			const uint32_t fields[3] = {First::id, static_cast<uint32_t>(text.size()), 0};
+			table.append(reinterpret_cast<const char*>(fields), sizeof(fields));
+			table.append(text);
+		}
+		const ct_str::binlog::ChunkHeader messages{ct_str::binlog::ChunkKind::messages, 0, table.size()};
+		data.append(reinterpret_cast<const char*>(&messages), sizeof(messages));
+		data.append(table);
+		const ct_str::binlog::RecordHeader record_header{First::id, 0, 5};
+		const ct_str::binlog::ChunkHeader  records{ct_str::binlog::ChunkKind::records, 0, sizeof(record_header)};
+		data.append(reinterpret_cast<const char*>(&records), sizeof(records));
+		data.append(reinterpret_cast<const char*>(&record_header), sizeof(record_header));
+
+		ct_str::binlog::LogReader reader;
+		REQUIRE(reader.parse(data));
+		REQUIRE(reader.collisions().size() == 1);
+		CHECK(reader.collisions()[0] == First::id);
+		CHECK(reader.message(First::id) == nullptr);
+		REQUIRE(reader.records().size() == 1);
+		CHECK(reader.text(reader.records()[0]) == "<ambiguous message 0x712ee0c4>");
+	}
+}
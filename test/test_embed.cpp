@@ -0,0 +1,87 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include "doctest.h"
+#include "ct_str_runtime.hpp"
+#include "test_assets.hpp"
+
+namespace
+{
+
+std::string read_asset(const char* name)
+{
+	std::ifstream in(std::string(CT_STR_TEST_ASSETS) + "/" + name, std::ios::binary);
+	return std::string((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+}
+
+std::string hex(const uint8_t* data, std::size_t len)
+{
+	static constexpr char digits[] = "0123456789abcdef";
+	std::string			  out;
+	for (std::size_t i = 0; i < len; ++i)
+		out += {digits[data[i] >> 4], digits[data[i] & 0x0F]};
+	return out;
+}
+
+}  // namespace
+
+TEST_SUITE("Embedded assets")
+{
+	TEST_CASE("Text asset matches its file")
+	{
+		using Page = test_assets::index_html;
+		const std::string file = read_asset("index.html");
+		static_assert(Page::data::view().starts_with("<!doctype html>\n"));
+		static_assert(Page::data::view().ends_with("</html>\n"));
+		static_assert(Page::size == Page::data::view().size());
+		static_assert(Page::size > 64);	 // spans several chunks
+		static_assert(Page::path::view() == "assets/index.html");
+
+		CHECK(Page::data::view() == file);
+		CHECK(Page::data::c_str()[Page::size] == '\0');
+		CHECK(Page::crc32 == ct_str::rt::crc32(file));
+		CHECK(Page::sha256::storage == ct_str::rt::sha256(file));
+		CHECK(Page::etag::view() == "\"" + hex(Page::sha256::value, 32) + "\"");
+	}
+
+	TEST_CASE("Digests agree with the compile-time hashes")
+	{
+		using Page = test_assets::index_html;
+		static_assert(Page::crc32 == ct_str::crc32<Page::data::fwd>());
+		static_assert(std::is_same_v<Page::sha256, ct_str::sha256<Page::data::fwd>>);
+	}
+
+	TEST_CASE("Binary asset matches its file")
+	{
+		using Pixels = test_assets::pixels_bin;
+		static_assert(Pixels::size == 256);
+		static_assert(Pixels::data::size() == 256);
+		static_assert(Pixels::data::storage[0] == 0x00 && Pixels::data::storage[255] == 0xFF);
+
+		const std::string file = read_asset("pixels.bin");
+		REQUIRE(file.size() == Pixels::size);
+		for (std::size_t i = 0; i < Pixels::size; ++i)
+			CHECK(Pixels::data::value[i] == static_cast<uint8_t>(file[i]));
+		CHECK(Pixels::crc32 == ct_str::rt::crc32(file));
+		CHECK(std::string_view(Pixels::data::hex()).substr(0, 8) == "00010203");
+	}
+
+	TEST_CASE("Empty text asset")
+	{
+		using Empty = test_assets::empty_txt;
+		static_assert(Empty::size == 0);
+		static_assert(Empty::data::view().empty());
+		static_assert(Empty::crc32 == 0);
+		CHECK(Empty::etag::view() == "\"e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855\"");
+	}
+}
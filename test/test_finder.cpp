@@ -0,0 +1,92 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#include <cstddef>
+#include <ostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include "doctest.h"
+#include "ct_str_runtime.hpp"
+
+namespace
+{
+
+// Every kernel available on this machine against std::string_view::find, for every start position
+template <ct_str::FixedString Needle>
+void check_kernels(const std::string& hay)
+{
+	using Finder = ct_str::finder<Needle>;
+	const std::string_view needle(Needle.data, Needle.size());
+	for (std::size_t start = 0; start < hay.size(); ++start)
+	{
+		const std::size_t expected = std::string_view(hay).find(needle, start);
+		CHECK(Finder::find(hay, start) == expected);
+		CHECK(Finder::find_scalar(hay.data(), hay.size(), start) == expected);
+#if CT_STR_X86_DISPATCH
+		CHECK(Finder::find_sse2(hay.data(), hay.size(), start) == expected);
+		if (ct_str::rt::cpu_features().avx2)
+			CHECK(Finder::find_avx2(hay.data(), hay.size(), start) == expected);
+#endif
+	}
+}
+
+}  // namespace
+
+TEST_SUITE("Finder")
+{
+	TEST_CASE("Same positions as ct_str::find")
+	{
+		static_assert(ct_str::finder<"world">::find("hello world") == ct_str::find<"hello world", "world">());
+		static_assert(ct_str::finder<"o">::find("hello world", 5) == ct_str::find<"hello world", "o", 5>());
+		static_assert(ct_str::finder<"xyz">::find("hello world") == ct_str::find<"hello world", "xyz">());
+		static_assert(ct_str::finder<"">::find("hello", 3) == ct_str::find<"hello", "", 3>());
+		static_assert(ct_str::finder<"hello world!">::find("hello") == ct_str::find<"hello", "hello world!">());
+		static_assert(ct_str::finder<"lo">::find("hello", 5) == ct_str::find<"hello", "lo", 5>());
+
+		const std::string text = "GET / HTTP/1.1\r\nHost: example.com\r\n\r\nbody";
+		CHECK(ct_str::finder<"\r\n\r\n">::find(text) == text.find("\r\n\r\n"));
+		CHECK(ct_str::finder<"\r\n\r\n">::contains(text));
+		CHECK_FALSE(ct_str::finder<"\r\n\r\n">::contains("GET / HTTP/1.1\r\n"));
+		CHECK(ct_str::finder<"xyz">::find(text) == ct_str::finder<"xyz">::npos);
+		CHECK(ct_str::finder<"xyz">::find("xy") == 2);
+		CHECK(ct_str::finder<"x">::find("abc", 3) == 3);
+	}
+
+	TEST_CASE("Probes pick rare bytes")
+	{
+		// 'z' and 'q' are the rarest letters
+		static_assert(ct_str::finder<"quietz">::probe.first == 5);
+		static_assert(ct_str::finder<"quietz">::probe.second == 0);
+		static_assert(ct_str::finder<"aaaa">::probe.first != ct_str::finder<"aaaa">::probe.second);
+		static_assert(ct_str::finder<"a">::probe.first == ct_str::finder<"a">::probe.second);
+	}
+
+	TEST_CASE("Kernels agree on matches near the ends and in the vector tails")
+	{
+		std::string hay(200, 'a');
+		hay[0]	 = 'q';
+		hay[199] = 'q';
+		for (std::size_t pos : {31u, 32u, 33u, 63u, 150u, 190u})
+			hay[pos] = 'q';
+		check_kernels<"q">(hay);
+		check_kernels<"qa">(hay);
+		check_kernels<"aq">(hay);
+		check_kernels<"aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaq">(hay);
+		check_kernels<"aaaaa">(hay);
+	}
+
+	TEST_CASE("Kernels agree on random text")
+	{
+		std::mt19937 rng(11);
+		std::string	 hay(1500, ' ');
+		for (auto& c : hay)
+			c = "ab\r\n"[rng() % 4];
+		check_kernels<"\r\n\r\n">(hay);
+		check_kernels<"abba">(hay);
+		check_kernels<"a\r\nb">(hay);
+		check_kernels<"bbbbbbbbbbbbbbbbbbbb">(hay);
+	}
+}
@@ -0,0 +1,126 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <ostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include "doctest.h"
+#include "ct_str.hpp"
+
+TEST_SUITE("Number Formatting")
+{
+	TEST_CASE("Decimal length")
+	{
+		static_assert(ct_str::decimal_length(0) == 1);
+		static_assert(ct_str::decimal_length(9) == 1);
+		static_assert(ct_str::decimal_length(10) == 2);
+		static_assert(ct_str::decimal_length(99) == 2);
+		static_assert(ct_str::decimal_length(100) == 3);
+		static_assert(ct_str::decimal_length(9'999'999'999'999'999'999ull) == 19);
+		static_assert(ct_str::decimal_length(10'000'000'000'000'000'000ull) == 20);
+		static_assert(ct_str::decimal_length(std::numeric_limits<uint64_t>::max()) == 20);
+		for (uint64_t p = 1, digits = 1; digits <= 19; p *= 10, ++digits)
+		{
+			CHECK(ct_str::decimal_length(p) == digits);
+			CHECK(ct_str::decimal_length(p * 10 - 1) == digits);
+		}
+	}
+
+	TEST_CASE("Decimal output matches snprintf")
+	{
+		auto check = [](auto value)
+		{
+			char expected[32];
+			std::snprintf(expected, sizeof(expected), "%lld", static_cast<long long>(value));
+			char		buf[32];
+			const char* end = ct_str::write_decimal(buf, value);
+			CHECK(std::string_view(buf, static_cast<std::size_t>(end - buf)) == expected);
+			CHECK(static_cast<std::size_t>(end - buf) <= ct_str::decimal_max_length<decltype(value)>);
+		};
+		check(0);
+		check(-1);
+		check(std::numeric_limits<int>::min());
+		check(std::numeric_limits<int64_t>::min());
+		check(std::numeric_limits<int64_t>::max());
+		check(std::numeric_limits<int8_t>::min());
+		check(static_cast<uint16_t>(65535));
+
+		std::mt19937_64 rng(42);
+		for (int i = 0; i < 1000; ++i)
+			check(static_cast<int64_t>(rng()) >> (i % 64));
+
+		char		buf[24];
+		const char* end = ct_str::write_decimal(buf, std::numeric_limits<uint64_t>::max());
+		CHECK(std::string_view(buf, static_cast<std::size_t>(end - buf)) == "18446744073709551615");
+	}
+}
+
+TEST_SUITE("Format")
+{
+	TEST_CASE("Segments and slots")
+	{
+		using Took = ct_str::format<"{}: took {} us">;
+		static_assert(Took::slots() == 2);
+		static_assert(Took::literals::view() == ": took  us");
+		static_assert(Took::literal_size() == 10);
+
+		char buf[64];
+		CHECK(Took::format_to(buf, "parse", 42) == "parse: took 42 us");
+		CHECK(Took::format_to(buf, std::string("load"), -7L) == "load: took -7 us");
+		CHECK(Took::size(std::string_view("x"), 12345u) == 1 + 10 + 5);
+	}
+
+	TEST_CASE("Argument kinds")
+	{
+		using All = ct_str::format<"[{}|{:d}|{:s}|{:c}|{}|{:s}]">;
+		char			  buf[128];
+		const std::string name = "ct";
+		CHECK(All::format_to(buf, true, uint64_t{18446744073709551615ull}, name, 'z', int16_t{-32768}, false) ==
+			  "[true|18446744073709551615|ct|z|-32768|false]");
+		CHECK(ct_str::format<"{}{}">::format_to(buf, 'a', 7) == "a7");
+		CHECK(ct_str::format<"id={:x} {:x}">::format_to(buf, 0xdeadbeefu, int16_t{-32768}) == "id=deadbeef -8000");
+		CHECK(ct_str::format<"{:x}">::size(std::numeric_limits<uint64_t>::max()) == 16);
+		CHECK(ct_str::format<"ratio={} scale={}">::format_to(buf, 0.1, 1e-7f) == "ratio=0.1 scale=1e-07");
+		CHECK(ct_str::format<"{}">::size(-2.2250738585072014e-308) == 24);
+	}
+
+	TEST_CASE("Escaped braces and empty segments")
+	{
+		using Braces = ct_str::format<"{{{}}} {{}}">;
+		static_assert(Braces::literals::view() == "{} {}");
+		char buf[32];
+		CHECK(Braces::format_to(buf, 5) == "{5} {}");
+		CHECK(ct_str::format<"{}{}{}">::format_to(buf, 1, 2, 3) == "123");
+		CHECK(ct_str::format<"no slots">::format_to(buf) == "no slots");
+		CHECK(ct_str::format<"">::format_to(buf).empty());
+	}
+
+	TEST_CASE("Small buffers are cut short")
+	{
+		using Line = ct_str::format<"id={} name={}">;
+		char buf[8] = {};
+		CHECK(Line::format_to(buf, 123456, "abc") == "id=12345");
+		CHECK(Line::write(buf, 5, 123456, "abc") == 18);
+		CHECK(std::string_view(buf, 5) == "id=12");
+		CHECK(Line::write(nullptr, 0, 1, "") == 10);
+
+		// Each cut-off point agrees with the full text
+		char			 full[64];
+		const std::string_view expected = Line::format_to(full, -99, "longer name");
+		for (std::size_t cap = 0; cap <= expected.size(); ++cap)
+		{
+			char small[64];
+			CHECK(Line::write(small, cap, -99, "longer name") == expected.size());
+			CHECK(std::string_view(small, cap) == expected.substr(0, cap));
+		}
+
+		using Hex = ct_str::format<"crc={:x}">;
+		CHECK(Hex::format_to(buf, 0x1234abcdu) == "crc=1234");
+	}
+}
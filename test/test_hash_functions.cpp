@@ -8,6 +8,34 @@ BSD-3-Clause License - See ct_str.hpp for full license text.
 #include "doctest.h"
 #include "ct_str.hpp"
 
+namespace
+{
+
+// Build an N-character string of a single repeated character
+template <std::size_t N>
+consteval auto repeated(char c)
+{
+	char buf[N + 1]{};
+	for (std::size_t i = 0; i < N; ++i)
+		buf[i] = c;
+	return ct_str::FixedString<char, N + 1>(buf, N);
+}
+
+// Bit-at-a-time CRC-32 reference
+constexpr uint32_t crc32_bitwise(const char* data, std::size_t len)
+{
+	uint32_t crc = 0xFFFFFFFF;
+	for (std::size_t i = 0; i < len; ++i)
+	{
+		crc ^= static_cast<uint8_t>(data[i]);
+		for (int j = 0; j < 8; ++j)
+			crc = (crc & 1) ? ((crc >> 1) ^ 0xEDB88320) : (crc >> 1);
+	}
+	return crc ^ 0xFFFFFFFF;
+}
+
+}  // namespace
+
 TEST_SUITE("Hash Functions")
 {
 	TEST_CASE("CRC32")
@@ -38,6 +66,34 @@ TEST_SUITE("Hash Functions")
 		CHECK(long_crc != 0);
 	}
 
+	TEST_CASE("CRC32 slicing tables")
+	{
+		// Slice 0 is the classic table
+		static_assert(ct_str::crc32_tables.table[0][0] == 0x00000000);
+		static_assert(ct_str::crc32_tables.table[0][1] == 0x77073096);
+		static_assert(ct_str::crc32_tables.table[0][255] == 0x2D02EF8D);
+
+		// Every length exercises a different mix of the 8-byte, 4-byte and single-byte steps
+		static constexpr char text[] = "The quick brown fox jumps over the lazy dog";
+		static_assert(ct_str::crc32<"The quick brown fox jumps over the lazy dog">() == 0x414FA339);
+		constexpr bool all_lengths_match = []
+		{
+			for (std::size_t len = 0; len < sizeof(text); ++len)
+			{
+				if (ct_str::crc32_update(0, text, len) != crc32_bitwise(text, len))
+					return false;
+			}
+			return true;
+		}();
+		static_assert(all_lengths_match);
+		CHECK(all_lengths_match);
+
+		// Chaining updates matches a single pass
+		constexpr uint32_t chained = ct_str::crc32_update(ct_str::crc32_update(0, text, 13), text + 13, sizeof(text) - 14);
+		static_assert(chained == 0x414FA339);
+		CHECK(chained == 0x414FA339);
+	}
+
 	TEST_CASE("SHA256")
 	{
 		// Basic hash
@@ -145,4 +201,70 @@ TEST_SUITE("Hash Functions")
 		using LongSHA512 = ct_str::sha512<long_string::fwd>;
 		static_assert(LongSHA512::size() == 64);
 	}
+
+	TEST_CASE("SHA padding boundaries")
+	{
+		// NIST two-block message
+		using Nist = ct_str::sha256<"abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq">;
+		CHECK(std::string(Nist::hex()) == "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+
+		// 55 bytes still fit the length field in one block, 56 spill into a second
+		CHECK(std::string(ct_str::sha256<repeated<55>('a')>::hex()) ==
+			  "9f4390f8d30c2dd92ec9f095b65e2b9ae9b0a925a5258e241c9f1e910f734318");
+		CHECK(std::string(ct_str::sha256<repeated<56>('a')>::hex()) ==
+			  "b35439a4ac6f0948b6d6f9e3c6af0f5f590ce20f1bde7090ef7970686ec6738a");
+		CHECK(std::string(ct_str::sha256<repeated<64>('a')>::hex()) ==
+			  "ffe054fe7ae0cb6dc65c3af9b61d5209f439851db43d0ba5997337df154668eb");
+
+		// SHA-512 boundaries are at 111/112 bytes
+		CHECK(std::string(ct_str::sha512<"abc">::hex()) ==
+			  "ddaf35a193617abacc417349ae20413112e6fa4e89a97ea20a9eeee64b55d39a"
+			  "2192992a274fc1a836ba3c23a3feebbd454d4423643ce80e2a9ac94fa54ca49f");
+		CHECK(std::string(ct_str::sha512<repeated<111>('a')>::hex()) ==
+			  "fa9121c7b32b9e01733d034cfc78cbf67f926c7ed83e82200ef86818196921760"
+			  "b4beff48404df811b953828274461673c68d04e297b0eb7b2b4d60fc6b566a2");
+		CHECK(std::string(ct_str::sha512<repeated<112>('a')>::hex()) ==
+			  "c01d080efd492776a1c43bd23dd99d0a2e626d481e16782e75d54c2503b5dc32b"
+			  "d05f0f1ba33e568b88fd2d970929b719ecbb152f58f130a407c8830604b70ca");
+	}
+
+	TEST_CASE("SHA inputs beyond the former 1 KiB / 2 KiB limits")
+	{
+		using Sha256Long = ct_str::sha256<repeated<4096>('a')>;
+		CHECK(std::string(Sha256Long::hex()) == "c93eee2d0db02f10acc7460d9576e122dcf8cd53c4bf8dfcae1b3e74ebcfff5a");
+
+		using Sha512Long = ct_str::sha512<repeated<4096>('a')>;
+		CHECK(std::string(Sha512Long::hex()) ==
+			  "eb7040948a189a59d72d1e53869fba1aeacb6c3be33c7be5d1f03f31a9660033"
+			  "b2018649b33325b48b317944664d8e71a64a7c6f29dd18acf162c8b0d13a214e");
+
+		using Sha256Huge = ct_str::sha256<repeated<20000>('a')>;
+		CHECK(std::string(Sha256Huge::hex()) == "cc17faaad36649c4603dda4d8ff97cb149722af0bcac0746305a2134ad2d0b97");
+	}
+
+	TEST_CASE("Incremental SHA engine")
+	{
+		static constexpr auto text = repeated<1000>('a');
+
+		// Feeding the input in uneven pieces matches the one-shot digest
+		constexpr auto sha256_pieces = []
+		{
+			ct_str::Sha256Engine engine;
+			engine.update(text.data, 1).update(text.data + 1, 62).update(text.data + 63, 500);
+			engine.update(text.data + 563, 437);
+			return engine.finish();
+		}();
+		static_assert(sha256_pieces == ct_str::sha256<text>::fwd);
+
+		constexpr auto sha512_pieces = []
+		{
+			ct_str::Sha512Engine engine;
+			engine.update(text.data, 127).update(text.data + 127, 0).update(text.data + 127, 873);
+			return engine.finish();
+		}();
+		static_assert(sha512_pieces == ct_str::sha512<text>::fwd);
+		CHECK(std::string(ct_str::sha512<text>::hex()) ==
+			  "67ba5535a46e3f86dbfbed8cbbaf0125c76ed549ff8b0b9e03e0c88cf90fa634"
+			  "fa7b12b47d77b694de488ace8d9a65967dc96df599727d3292a8d9d447709c97");
+	}
 }
\ No newline at end of file
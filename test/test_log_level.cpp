@@ -0,0 +1,109 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#include <string_view>
+#include "doctest.h"
+#include "ct_str.hpp"
+
+namespace
+{
+
+using ct_str::LogLevel;
+
+using Levels = ct_str::LogLevels<LogLevel::info,
+								 ct_str::ModuleLevel<"test_log_level", LogLevel::debug>,
+								 ct_str::ModuleLevel<"net", LogLevel::warn>,
+								 ct_str::ModuleLevel<"quiet", LogLevel::off>>;
+
+using this_module = ct_str::stem<__FILE__>;
+
+// Counts the calls that get past the level checks, the way a logging function would use them
+int logged = 0;
+
+template <LogLevel Level, ct_str::FixedString Module>
+void log_at()
+{
+	if constexpr (Levels::compiled_in<Level, Module>)
+	{
+		if (Levels::enabled<Level, Module>())
+			++logged;
+	}
+}
+
+}  // namespace
+
+TEST_SUITE("Log Levels")
+{
+	TEST_CASE("Floors come from the table")
+	{
+		static_assert(this_module::view() == "test_log_level");
+		static_assert(Levels::row<this_module::fwd>() == 0);
+		static_assert(Levels::row<"net">() == 1);
+		static_assert(Levels::row<"storage">() == Levels::modules);
+
+		static_assert(Levels::floor<this_module::fwd> == LogLevel::debug);
+		static_assert(Levels::floor<"net"> == LogLevel::warn);
+		static_assert(Levels::floor<"storage"> == LogLevel::info);
+
+		static_assert(!Levels::compiled_in<LogLevel::trace, this_module::fwd>);
+		static_assert(Levels::compiled_in<LogLevel::debug, this_module::fwd>);
+		static_assert(!Levels::compiled_in<LogLevel::info, "net">);
+		static_assert(Levels::compiled_in<LogLevel::error, "net">);
+		static_assert(!Levels::compiled_in<LogLevel::error, "quiet">);
+		static_assert(!Levels::compiled_in<LogLevel::off, "storage">);
+
+		// A listed module name must match exactly
+		static_assert(Levels::floor<"network"> == LogLevel::info);
+	}
+
+	TEST_CASE("Runtime levels start at the floor and can be raised")
+	{
+		Levels::set_level("*", LogLevel::trace);
+		CHECK(Levels::level<this_module::fwd>() == LogLevel::debug);
+		CHECK(Levels::level<"net">() == LogLevel::warn);
+		CHECK(Levels::level<"storage">() == LogLevel::info);
+
+		logged = 0;
+		log_at<LogLevel::trace, this_module::fwd>();
+		log_at<LogLevel::debug, this_module::fwd>();
+		log_at<LogLevel::info, "net">();
+		log_at<LogLevel::warn, "net">();
+		log_at<LogLevel::info, "storage">();
+		log_at<LogLevel::error, "quiet">();
+		CHECK(logged == 3);
+
+		CHECK(Levels::set_level<this_module::fwd>(LogLevel::warn) == LogLevel::warn);
+		CHECK_FALSE(Levels::enabled<LogLevel::debug, this_module::fwd>());
+		CHECK_FALSE(Levels::enabled<LogLevel::info, this_module::fwd>());
+		CHECK(Levels::enabled<LogLevel::warn, this_module::fwd>());
+
+		// Lowering stops at the floor
+		CHECK(Levels::set_level<this_module::fwd>(LogLevel::trace) == LogLevel::debug);
+		CHECK(Levels::enabled<LogLevel::debug, this_module::fwd>());
+		CHECK(Levels::set_level("quiet", LogLevel::trace) == LogLevel::off);
+		CHECK_FALSE(Levels::enabled<LogLevel::error, "quiet">());
+	}
+
+	TEST_CASE("Levels can be set by name")
+	{
+		CHECK(Levels::set_level("net", LogLevel::error) == LogLevel::error);
+		CHECK(Levels::level<"net">() == LogLevel::error);
+		CHECK_FALSE(Levels::enabled<LogLevel::warn, "net">());
+
+		// Unlisted names are rejected and leave every row alone; they share one row, set on its own
+		CHECK_FALSE(Levels::set_level("storage", LogLevel::warn).has_value());
+		CHECK_FALSE(Levels::set_level("nett", LogLevel::error).has_value());
+		CHECK(Levels::level<"cache">() == LogLevel::info);
+		CHECK(Levels::set_default_level(LogLevel::warn) == LogLevel::warn);
+		CHECK(Levels::level<"cache">() == LogLevel::warn);
+		CHECK(Levels::level<"storage">() == LogLevel::warn);
+		CHECK_FALSE(Levels::enabled<LogLevel::info, "cache">());
+
+		Levels::set_level("*", LogLevel::trace);
+		CHECK(Levels::level<"net">() == LogLevel::warn);
+		CHECK(Levels::level<"cache">() == LogLevel::info);
+		CHECK(Levels::enabled<LogLevel::info, "cache">());
+	}
+}
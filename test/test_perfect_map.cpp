@@ -0,0 +1,92 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#include <ostream>
+#include <string>
+#include "doctest.h"
+#include "ct_str.hpp"
+
+// Preprocessor-generated key sets: PM_KEYS_10000(k) expands to "k0000", "k0001", ..., "k9999"
+#define PM_STR(x) PM_STR_(x)
+#define PM_STR_(x) #x
+#define PM_KEYS_10(p) \
+	PM_STR(p##0), PM_STR(p##1), PM_STR(p##2), PM_STR(p##3), PM_STR(p##4), PM_STR(p##5), PM_STR(p##6), PM_STR(p##7), \
+		PM_STR(p##8), PM_STR(p##9)
+#define PM_KEYS_100(p) \
+	PM_KEYS_10(p##0), PM_KEYS_10(p##1), PM_KEYS_10(p##2), PM_KEYS_10(p##3), PM_KEYS_10(p##4), PM_KEYS_10(p##5), \
+		PM_KEYS_10(p##6), PM_KEYS_10(p##7), PM_KEYS_10(p##8), PM_KEYS_10(p##9)
+#define PM_KEYS_1000(p) \
+	PM_KEYS_100(p##0), PM_KEYS_100(p##1), PM_KEYS_100(p##2), PM_KEYS_100(p##3), PM_KEYS_100(p##4), \
+		PM_KEYS_100(p##5), PM_KEYS_100(p##6), PM_KEYS_100(p##7), PM_KEYS_100(p##8), PM_KEYS_100(p##9)
+#define PM_KEYS_10000(p) \
+	PM_KEYS_1000(p##0), PM_KEYS_1000(p##1), PM_KEYS_1000(p##2), PM_KEYS_1000(p##3), PM_KEYS_1000(p##4), \
+		PM_KEYS_1000(p##5), PM_KEYS_1000(p##6), PM_KEYS_1000(p##7), PM_KEYS_1000(p##8), PM_KEYS_1000(p##9)
+
+TEST_SUITE("Perfect Map")
+{
+	using Methods = ct_str::perfect_map<"GET", "HEAD", "POST", "PUT", "DELETE", "CONNECT", "OPTIONS", "TRACE", "PATCH">;
+
+	TEST_CASE("Lookup returns declaration indices")
+	{
+		static_assert(Methods::size() == 9);
+		static_assert(Methods::find("GET") == 0);
+		static_assert(Methods::find("PATCH") == 8);
+		static_assert(Methods::index_of<"DELETE">() == 4);
+		static_assert(Methods::key(2) == "POST");
+
+		CHECK(Methods::find(std::string("OPTIONS")) == 6);
+		CHECK(Methods::find(std::string("TRACE")) == 7);
+		CHECK(Methods::contains("HEAD"));
+		for (std::size_t i = 0; i < Methods::size(); ++i)
+			CHECK(Methods::find(Methods::key(i)) == i);
+	}
+
+	TEST_CASE("Keys outside the set are rejected")
+	{
+		CHECK(Methods::find("") == Methods::npos);
+		CHECK(Methods::find("get") == Methods::npos);
+		CHECK(Methods::find("GETS") == Methods::npos);
+		CHECK(Methods::find("GE") == Methods::npos);
+		CHECK_FALSE(Methods::contains("PURGE"));
+		static_assert(!Methods::contains("LINK"));
+	}
+
+	TEST_CASE("Single key, empty key and long keys")
+	{
+		using One = ct_str::perfect_map<"only">;
+		static_assert(One::find("only") == 0);
+		static_assert(One::find("other") == One::npos);
+
+		using WithEmpty = ct_str::perfect_map<"", "a", "a_much_longer_key_spanning_several_eight_byte_words">;
+		static_assert(WithEmpty::find("") == 0);
+		static_assert(WithEmpty::find("a") == 1);
+		static_assert(WithEmpty::find("a_much_longer_key_spanning_several_eight_byte_words") == 2);
+		static_assert(WithEmpty::find("a_much_longer_key_spanning_several_eight_byte_word") == WithEmpty::npos);
+	}
+
+	TEST_CASE("Wide character keys")
+	{
+		using Wide = ct_str::perfect_map<L"alpha", L"beta", L"gamma">;
+		static_assert(Wide::find(L"gamma") == 2);
+		static_assert(Wide::find(L"delta") == Wide::npos);
+	}
+
+	TEST_CASE("Ten thousand keys")
+	{
+		using Large = ct_str::perfect_map<PM_KEYS_10000(k)>;
+		static_assert(Large::size() == 10000);
+		static_assert(Large::index_of<"k4242">() == 4242);
+
+		std::size_t found = 0;
+		for (std::size_t i = 0; i < Large::size(); ++i)
+		{
+			std::string key = "k" + std::to_string(10000 + i).substr(1);
+			found += Large::find(key) == i;
+		}
+		CHECK(found == Large::size());
+		CHECK(Large::find("k10000") == Large::npos);
+		CHECK(Large::find("k") == Large::npos);
+	}
+}
@@ -0,0 +1,94 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#include <cstddef>
+#include <ostream>
+#include <string_view>
+#include "doctest.h"
+#include "ct_str.hpp"
+
+namespace op = ct_str::op;
+
+namespace
+{
+
+// A stage defined outside the library
+struct drop_vowels
+{
+	template <typename Text>
+	static constexpr void apply(Text& text)
+	{
+		std::size_t kept = 0;
+		for (std::size_t i = 0; i < text.size; ++i)
+		{
+			const auto c = text.data[i];
+			if (c != 'a' && c != 'e' && c != 'i' && c != 'o' && c != 'u')
+				text.data[kept++] = c;
+		}
+		text.size = kept;
+	}
+};
+
+}  // namespace
+
+TEST_SUITE("Pipe")
+{
+	TEST_CASE("Chains stages in order")
+	{
+		using Key = ct_str::pipe<"  db-host-name  ", op::trim, op::to_upper, op::replace_all<"-", "_">>;
+		static_assert(Key::view() == "DB_HOST_NAME");
+		static_assert(Key::fwd.size() == 12);
+		CHECK(std::string_view(Key::c_str()) == "DB_HOST_NAME");
+
+		using Nested = ct_str::replace_all<ct_str::to_upper<ct_str::trim<"  db-host-name  ">::fwd>::fwd, "-", "_">;
+		CHECK(Key::c_str() == Nested::c_str());
+	}
+
+	TEST_CASE("Matches the nested transformations")
+	{
+		constexpr ct_str::FixedString str = "\t Hello, World - hello, world \n";
+		static_assert(ct_str::pipe<str>::view() == ct_str::StringStore<str>::view());
+		static_assert(ct_str::pipe<str, op::trim_left>::view() == ct_str::trim_left<str>::view());
+		static_assert(ct_str::pipe<str, op::trim_right>::view() == ct_str::trim_right<str>::view());
+		static_assert(ct_str::pipe<str, op::to_lower>::view() == ct_str::to_lower<str>::view());
+		static_assert(ct_str::pipe<str, op::reverse>::view() == ct_str::reverse<str>::view());
+		static_assert(ct_str::pipe<str, op::substr<3, 5>>::view() == ct_str::substr<str, 3, 5>::view());
+		static_assert(ct_str::pipe<str, op::substr<30, 5>>::view() == ct_str::substr<str, 30, 5>::view());
+		static_assert(ct_str::pipe<str, op::substr<99, 5>>::view() == ct_str::substr<str, 99, 5>::view());
+		static_assert(ct_str::pipe<str, op::left<4>>::view() == ct_str::left<str, 4>::view());
+		static_assert(ct_str::pipe<str, op::left<99>>::view() == ct_str::left<str, 99>::view());
+		static_assert(ct_str::pipe<str, op::right<4>>::view() == ct_str::right<str, 4>::view());
+		static_assert(ct_str::pipe<str, op::right<99>>::view() == ct_str::right<str, 99>::view());
+		static_assert(ct_str::pipe<str, op::append<"!", "?">>::view() == ct_str::append<str, "!", "?">::view());
+		static_assert(ct_str::pipe<str, op::replace<"o", "0">>::view() == ct_str::replace<str, "o", "0">::view());
+		static_assert(ct_str::pipe<str, op::replace<"", "x">>::view() == ct_str::replace<str, "", "x">::view());
+		static_assert(ct_str::pipe<str, op::replace_all<"l", "L">>::view() ==
+					  ct_str::replace_all<str, "l", "L">::view());
+		static_assert(ct_str::pipe<str, op::replace_all<"ll", "">>::view() ==
+					  ct_str::replace_all<str, "ll", "">::view());
+		static_assert(ct_str::pipe<str, op::replace_n<"o", "()", 2>>::view() ==
+					  ct_str::replace_n<str, "o", "()", 2>::view());
+		static_assert(ct_str::pipe<"aaaa", op::replace_all<"aa", "a">>::view() == "aa");
+		static_assert(ct_str::pipe<"   ", op::trim>::view().empty());
+	}
+
+	TEST_CASE("Long chains and custom stages")
+	{
+		using Name = ct_str::pipe<"  Config.Section-Seven  ", op::trim, op::to_lower, op::replace_all<".", "::">,
+								  op::replace_all<"-", "_">, op::append<"_key">, drop_vowels>;
+		static_assert(Name::view() == "cnfg::sctn_svn_ky");
+
+		// Growth bounds: "." -> "::" can at most double, then the suffix is appended
+		static_assert(ct_str::pipe_capacity<op::replace_all<".", "::">, op::append<"_key">>(10) == 24);
+		static_assert(ct_str::pipe_capacity<op::trim, op::replace_n<"a", "bbb", 2>>(10) == 14);
+		static_assert(ct_str::pipe_capacity<op::replace_all<"ab", "c">>(10) == 10);
+	}
+
+	TEST_CASE("Wide characters")
+	{
+		using Wide = ct_str::pipe<L"  a-b  ", op::trim, op::to_upper, op::replace_all<L"-", L"+">>;
+		static_assert(Wide::view() == L"A+B");
+	}
+}
@@ -0,0 +1,168 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#include <cstddef>
+#include <ostream>
+#include <random>
+#include <regex>
+#include <string>
+#include <string_view>
+#include "doctest.h"
+#include "ct_str.hpp"
+
+namespace
+{
+
+// Random strings over alphabet, with lengths up to max_len, checked against std::regex in ECMAScript mode
+template <ct_str::FixedString Pattern>
+void check_against_std_regex(std::string_view alphabet, std::size_t max_len, int count = 2000)
+{
+	using Regex = ct_str::regex<Pattern>;
+	const std::regex reference(std::string(Pattern.data, Pattern.size()));
+
+	std::mt19937 rng(Pattern.size());
+	for (int i = 0; i < count; ++i)
+	{
+		std::string text(rng() % (max_len + 1), ' ');
+		for (auto& c : text)
+			c = alphabet[rng() % alphabet.size()];
+
+		CHECK(Regex::match(text) == std::regex_match(text, reference));
+		CHECK(Regex::search(text) == std::regex_search(text, reference));
+	}
+}
+
+}  // namespace
+
+TEST_SUITE("Regex")
+{
+	TEST_CASE("Whole-string match and substring search")
+	{
+		using Id = ct_str::regex<"[a-z]+_[0-9]{3}">;
+		static_assert(Id::match("order_123"));
+		static_assert(!Id::match("order_12"));
+		static_assert(!Id::match("order_1234"));
+		static_assert(!Id::match("Order_123"));
+		static_assert(!Id::match(""));
+		static_assert(Id::search("id=order_123;"));
+		static_assert(!Id::search("id=_123;"));
+
+		const std::string field = "x_000";
+		CHECK(Id::match(field));
+		CHECK_FALSE(Id::match("x_00a"));
+	}
+
+	TEST_CASE("Anchors")
+	{
+		static_assert(ct_str::regex<"^ab">::search("abc"));
+		static_assert(!ct_str::regex<"^ab">::search("cab"));
+		static_assert(ct_str::regex<"ab$">::search("cab"));
+		static_assert(!ct_str::regex<"ab$">::search("abc"));
+		static_assert(ct_str::regex<"^ab$">::search("ab"));
+		static_assert(!ct_str::regex<"^ab$">::search("abab"));
+		static_assert(ct_str::regex<"^ab$">::match("ab"));
+		static_assert(ct_str::regex<"a\\$">::search("a$b"));
+		static_assert(ct_str::regex<"">::match(""));
+		static_assert(ct_str::regex<"">::search("anything"));
+	}
+
+	TEST_CASE("Escapes and classes")
+	{
+		static_assert(ct_str::regex<"\\d+\\.\\d+">::match("3.14"));
+		static_assert(!ct_str::regex<"\\d+\\.\\d+">::match("3x14"));
+		static_assert(ct_str::regex<"\\w+\\s\\w+">::match("hello\tworld"));
+		static_assert(ct_str::regex<"[^\\s]+">::match("no-spaces"));
+		static_assert(!ct_str::regex<"[^\\s]+">::match("a space"));
+		static_assert(ct_str::regex<"\\x41[\\x30-\\x39]">::match("A7"));
+		static_assert(ct_str::regex<"[-a]+">::match("-a-"));
+		static_assert(ct_str::regex<"[a\\]]+">::match("a]a"));
+		static_assert(ct_str::regex<"\\D\\W\\S">::match("a!x"));
+		static_assert(!ct_str::regex<"\\D\\W\\S">::match("a! "));
+		static_assert(ct_str::regex<"a.c">::match("a-c"));
+		static_assert(!ct_str::regex<"a.c">::match("a\nc"));
+	}
+
+	TEST_CASE("Request validation patterns")
+	{
+		using Uuid = ct_str::regex<"[0-9a-f]{8}-[0-9a-f]{4}-[0-9a-f]{4}-[0-9a-f]{4}-[0-9a-f]{12}">;
+		CHECK(Uuid::match("123e4567-e89b-12d3-a456-426614174000"));
+		CHECK_FALSE(Uuid::match("123e4567-e89b-12d3-a456-42661417400"));
+		CHECK_FALSE(Uuid::match("123e4567-e89b-12d3-a456-42661417400g"));
+
+		using Email = ct_str::regex<"[\\w.+-]+@[\\w-]+(\\.[\\w-]+)+">;
+		CHECK(Email::match("first.last+tag@example.co.uk"));
+		CHECK_FALSE(Email::match("first.last@localhost"));
+		CHECK_FALSE(Email::match("@example.com"));
+
+		using Method = ct_str::regex<"GET|HEAD|POST|PUT|DELETE">;
+		CHECK(Method::match("DELETE"));
+		CHECK_FALSE(Method::match("DELET"));
+		CHECK(Method::search("method=POST"));
+	}
+
+	TEST_CASE("Syntax errors are reported by the compiler")
+	{
+		// ct_str::regex turns these into static_assert failures
+		using ct_str::RegexError;
+		constexpr auto error = [](std::string_view pattern)
+		{ return ct_str::regex_compile(pattern.data(), pattern.size(), false).error; };
+
+		static_assert(error("(ab") == RegexError::unbalanced_parens);
+		static_assert(error("ab)") == RegexError::unbalanced_parens);
+		static_assert(error("*a") == RegexError::nothing_to_repeat);
+		static_assert(error("a**") == RegexError::nothing_to_repeat);
+		static_assert(error("a{3,2}") == RegexError::bad_repeat);
+		static_assert(error("a{1001}") == RegexError::bad_repeat);
+		static_assert(error("a{x}") == RegexError::bad_repeat);
+		static_assert(error("[a-") == RegexError::bad_class);
+		static_assert(error("[z-a]") == RegexError::bad_class);
+		static_assert(error("\\bword") == RegexError::bad_escape);
+		static_assert(error("a^b") == RegexError::misplaced_anchor);
+		static_assert(error("^a|b") == RegexError::misplaced_anchor);
+		static_assert(error("(a{1000}){1000}") == RegexError::too_many_states);
+		static_assert(error("^(a|b)c$") == RegexError::none);
+	}
+
+	TEST_CASE("Long counted repetition")
+	{
+		using Hex64 = ct_str::regex<"[0-9a-f]{64}">;
+		const std::string digest(64, 'e');
+		CHECK(Hex64::match(digest));
+		CHECK_FALSE(Hex64::match(digest + "e"));
+		CHECK_FALSE(Hex64::match(digest.substr(1)));
+		CHECK(Hex64::search("sha256=" + digest));
+	}
+
+	TEST_CASE("Searches that need many states")
+	{
+		// Searching for a[ab]{9} has to remember where the 'a's were among the last ten characters
+		using Tenth = ct_str::regex<"a[ab]{9}">;
+		static_assert(Tenth::match("abbbbbbbbb"));
+		static_assert(!Tenth::match("abbbbbbbb"));
+		static_assert(Tenth::search("bbbabababababbb"));
+		static_assert(!Tenth::search("bbbbbbbbbbbabbb"));
+		check_against_std_regex<"a[ab]{9}">("ab", 16);
+
+		// Eight times as many states does not fit under regex_max_dfa_states. Reaching the limit takes more steps than
+		// a compiler allows in one constant expression, so this one is compiled at runtime.
+		static_assert(ct_str::regex_compile("a[ab]{9}", 8, true).error == ct_str::RegexError::none);
+		CHECK(ct_str::regex_compile("a[ab]{12}", 9, true).error == ct_str::RegexError::too_many_states);
+	}
+
+	TEST_CASE("Agrees with std::regex")
+	{
+		check_against_std_regex<"[a-z]+_[0-9]{3}">("ab_019", 10);
+		check_against_std_regex<"(a|b)*abb">("ab", 12);
+		check_against_std_regex<"a{2,3}(b|c?)+d">("abcd", 10);
+		check_against_std_regex<"(ab|a)(bc|c)?">("abc", 8);
+		check_against_std_regex<"x*|y+z{2,}">("xyz", 10);
+		check_against_std_regex<"(?:a[^a]){2}|b{3}">("abc", 8);
+		check_against_std_regex<"^(a|ba)+$">("ab", 10);
+		check_against_std_regex<"^a.c">("abc\n", 8);
+		check_against_std_regex<"b\\d$">("b19 ", 8);
+		check_against_std_regex<"((a*)*b)*c">("abc", 10);
+		check_against_std_regex<"a+?b??c*?">("abc", 8);
+	}
+}
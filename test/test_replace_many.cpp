@@ -0,0 +1,65 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#include <cstring>
+#include <ostream>
+#include <string_view>
+#include "doctest.h"
+#include "ct_str.hpp"
+
+using ct_str::pair;
+
+TEST_SUITE("replace_many")
+{
+	TEST_CASE("HTML escaping")
+	{
+		using Escaped = ct_str::replace_many<"<a href=\"x\">Tom & 'Jerry'</a>", pair<"&", "&amp;">, pair<"<", "&lt;">,
+											 pair<">", "&gt;">, pair<"\"", "&quot;">, pair<"'", "&#39;">>;
+		static_assert(Escaped::view() == "&lt;a href=&quot;x&quot;&gt;Tom &amp; &#39;Jerry&#39;&lt;/a&gt;");
+		CHECK(std::strcmp(Escaped::c_str(), Escaped::value) == 0);
+		CHECK(Escaped::c_str()[Escaped::view().size()] == '\0');
+	}
+
+	TEST_CASE("Replacements are not rescanned")
+	{
+		// Nested replace_all would turn the "&" of "&lt;" into "&amp;"
+		using Once	 = ct_str::replace_many<"<&>", pair<"<", "&lt;">, pair<"&", "&amp;">>;
+		using Nested = ct_str::replace_all<ct_str::replace_all<"<&>", "<", "&lt;">::fwd, "&", "&amp;">;
+		static_assert(Once::view() == "&lt;&amp;>");
+		static_assert(Nested::view() == "&amp;lt;&amp;>");
+
+		// Swapping two patterns needs no placeholder
+		static_assert(ct_str::replace_many<"a-b-a", pair<"a", "b">, pair<"b", "a">>::view() == "b-a-b");
+	}
+
+	TEST_CASE("Longest match at the leftmost position")
+	{
+		using Template = ct_str::replace_many<"${name} is ${named}; $$ {name}", pair<"${name}", "Ada">,
+											  pair<"${named}", "called">, pair<"$$", "$">, pair<"$", "?">>;
+		static_assert(Template::view() == "Ada is called; $ {name}");
+
+		// A match that starts first wins over a longer one starting inside it
+		static_assert(ct_str::replace_many<"abcd", pair<"ab", "1">, pair<"bcd", "2">>::view() == "1cd");
+		static_assert(ct_str::replace_many<"abcd", pair<"bcd", "2">, pair<"a", "1">>::view() == "12");
+		static_assert(ct_str::replace_many<"aaaaa", pair<"aa", "b">>::view() == "bba");
+	}
+
+	TEST_CASE("Agrees with replace_all for a single pair")
+	{
+		static_assert(ct_str::replace_many<"a.b.c", pair<".", "::">>::view() ==
+					  ct_str::replace_all<"a.b.c", ".", "::">::view());
+		static_assert(ct_str::replace_many<"abababa", pair<"aba", "x">>::view() ==
+					  ct_str::replace_all<"abababa", "aba", "x">::view());
+		static_assert(ct_str::replace_many<"keep", pair<"zz", "y">>::view() == "keep");
+	}
+
+	TEST_CASE("Result sizes")
+	{
+		static_assert(ct_str::replace_many<"", pair<"x", "y">>::view().empty());
+		static_assert(ct_str::replace_many<"xxx", pair<"x", "">>::view().empty());
+		static_assert(ct_str::replace_many<"a\tb\n", pair<"\t", "\\t">, pair<"\n", "\\n">>::view() == "a\\tb\\n");
+		static_assert(ct_str::replace_many<"-", pair<"-", "0123456789">>::view().size() == 10);
+	}
+}
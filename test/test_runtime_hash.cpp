@@ -0,0 +1,250 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <ostream>
+#include <random>
+#include <vector>
+#include "doctest.h"
+#include "ct_str_runtime.hpp"
+
+namespace
+{
+
+std::vector<std::byte> random_bytes(std::size_t len, unsigned seed)
+{
+	std::mt19937		   gen(seed);
+	std::vector<std::byte> buf(len);
+	for (auto& b : buf)
+		b = static_cast<std::byte>(gen() & 0xFF);
+	return buf;
+}
+
+// Byte-at-a-time reference using only slice 0 of the shared tables
+uint32_t crc32_bytewise(const std::byte* data, std::size_t len)
+{
+	uint32_t crc = 0xFFFFFFFF;
+	for (std::size_t i = 0; i < len; ++i)
+		crc = ct_str::crc32_tables.table[0][(crc ^ static_cast<uint8_t>(data[i])) & 0xFF] ^ (crc >> 8);
+	return crc ^ 0xFFFFFFFF;
+}
+
+// Reference digest through the constexpr engine evaluated at runtime
+ct_str::FixedBytes<32> sha256_reference(const std::byte* data, std::size_t len)
+{
+	return ct_str::Sha256Engine{}.update(data, len).finish();
+}
+
+ct_str::FixedBytes<64> sha512_reference(const std::byte* data, std::size_t len)
+{
+	return ct_str::Sha512Engine{}.update(data, len).finish();
+}
+
+}  // namespace
+
+TEST_SUITE("Runtime Hash Functions")
+{
+	TEST_CASE("rt::crc32 matches ct_str::crc32")
+	{
+		CHECK(ct_str::rt::crc32("") == ct_str::crc32<"">());
+		CHECK(ct_str::rt::crc32("123456789") == ct_str::crc32<"123456789">());
+		CHECK(ct_str::rt::crc32("max_connections") == ct_str::crc32<"max_connections">());
+
+		using long_string =
+			ct_str::StringStore<"Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor "
+								"incididunt ut labore et dolore magna aliqua. Ut enim ad minim veniam, quis nostrud">;
+		CHECK(ct_str::rt::crc32(long_string::view()) == ct_str::crc32<long_string::fwd>());
+
+		// Byte span overload
+		const std::byte bytes[] = {std::byte{'1'}, std::byte{'2'}, std::byte{'3'}};
+		CHECK(ct_str::rt::crc32(std::span(bytes)) == ct_str::crc32<"123">());
+	}
+
+	TEST_CASE("rt::crc32 kernels agree")
+	{
+		const auto buf = random_bytes(4096 + 64, 1234);
+
+		// Every length up to a few folding blocks, at several misalignments
+		for (std::size_t offset = 0; offset < 4; ++offset)
+		{
+			for (std::size_t len = 0; len <= 300; ++len)
+			{
+				const std::byte* p		  = buf.data() + offset;
+				const uint32_t	 expected = crc32_bytewise(p, len);
+				CHECK(ct_str::rt::crc32_slicing16(0, p, len) == expected);
+				CHECK(ct_str::crc32_update(0, p, len) == expected);
+#if CT_STR_X86_DISPATCH
+				if (ct_str::rt::cpu_features().pclmul && ct_str::rt::cpu_features().sse41)
+					CHECK(ct_str::rt::crc32_pclmul(0, p, len) == expected);
+#endif
+			}
+		}
+
+		// Large buffer through the dispatched kernel
+		const auto big = random_bytes(1 << 20, 99);
+		CHECK(ct_str::rt::crc32(std::span(big)) == crc32_bytewise(big.data(), big.size()));
+	}
+
+	TEST_CASE("rt::Crc32 incremental update")
+	{
+		const auto		   buf		= random_bytes(10000, 7);
+		const uint32_t	   expected = ct_str::rt::crc32(std::span(buf));
+		std::mt19937	   gen(42);
+		ct_str::rt::Crc32 crc;
+
+		// Split into random pieces, including empty ones
+		std::size_t pos = 0;
+		while (pos < buf.size())
+		{
+			std::size_t piece = std::min<std::size_t>(gen() % 200, buf.size() - pos);
+			crc.update(std::span(buf).subspan(pos, piece));
+			pos += piece;
+		}
+		CHECK(crc.value() == expected);
+
+		crc.reset();
+		crc.update("1234").update("56789");
+		CHECK(crc.value() == ct_str::crc32<"123456789">());
+	}
+
+	TEST_CASE("rt::sha256 matches ct_str::sha256")
+	{
+		CHECK(ct_str::rt::sha256("") == ct_str::sha256<"">::fwd);
+		CHECK(ct_str::rt::sha256("abc") == ct_str::sha256<"abc">::fwd);
+		CHECK(ct_str::rt::sha256("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq") ==
+			  ct_str::sha256<"abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq">::fwd);
+
+		const std::byte bytes[] = {std::byte{'a'}, std::byte{'b'}, std::byte{'c'}};
+		CHECK(ct_str::rt::sha256(std::span(bytes)) == ct_str::sha256<"abc">::fwd);
+	}
+
+	TEST_CASE("rt::sha256 kernels agree")
+	{
+		const auto buf = random_bytes(64 * 40, 5);
+
+		for (std::size_t blocks = 0; blocks <= 40; ++blocks)
+		{
+			uint32_t expected[8], actual[8];
+			for (int i = 0; i < 8; ++i)
+				expected[i] = actual[i] = ct_str::sha256_init[i];
+			ct_str::Sha256Traits::compress_blocks(expected, buf.data(), blocks);
+			ct_str::rt::sha256_blocks_scalar(actual, buf.data(), blocks);
+			CHECK(std::equal(expected, expected + 8, actual));
+#if CT_STR_X86_DISPATCH
+			if (ct_str::rt::cpu_features().sha && ct_str::rt::cpu_features().sse41)
+			{
+				for (int i = 0; i < 8; ++i)
+					actual[i] = ct_str::sha256_init[i];
+				ct_str::rt::sha256_blocks_shani(actual, buf.data(), blocks);
+				CHECK(std::equal(expected, expected + 8, actual));
+			}
+#endif
+		}
+
+		// Every padding case through the dispatched streaming path
+		for (std::size_t len = 0; len <= 300; ++len)
+			CHECK(ct_str::rt::sha256(std::span(buf.data(), len)) == sha256_reference(buf.data(), len));
+	}
+
+	TEST_CASE("rt::Sha256 incremental update")
+	{
+		const auto	   buf		= random_bytes(5000, 11);
+		const auto	   expected = sha256_reference(buf.data(), buf.size());
+		std::mt19937   gen(3);
+		ct_str::rt::Sha256 sha;
+
+		std::size_t pos = 0;
+		while (pos < buf.size())
+		{
+			std::size_t piece = std::min<std::size_t>(gen() % 150, buf.size() - pos);
+			sha.update(std::span(buf).subspan(pos, piece));
+			pos += piece;
+		}
+		CHECK(sha.finish() == expected);
+
+		CHECK(ct_str::rt::Sha256{}.update("ab").update("c").finish() == ct_str::sha256<"abc">::fwd);
+	}
+
+	TEST_CASE("rt::sha256_batch")
+	{
+		// Mixed lengths so lanes finish at different blocks, and a count that leaves a partial group of 8
+		const auto						   buf = random_bytes(4096, 17);
+		std::vector<std::span<const std::byte>> messages;
+		std::mt19937					   gen(8);
+		for (std::size_t i = 0; i < 37; ++i)
+		{
+			std::size_t len	   = (i < 4) ? i * 55 : gen() % 1000;
+			std::size_t offset = gen() % (buf.size() - len);
+			messages.push_back(std::span(buf).subspan(offset, len));
+		}
+
+		std::vector<ct_str::FixedBytes<32>> digests(messages.size());
+		ct_str::rt::sha256_batch(messages, digests);
+		for (std::size_t i = 0; i < messages.size(); ++i)
+			CHECK(digests[i] == sha256_reference(messages[i].data(), messages[i].size()));
+
+#if CT_STR_X86_DISPATCH
+		if (ct_str::rt::cpu_features().avx2)
+		{
+			std::vector<ct_str::FixedBytes<32>> lanes(messages.size());
+			ct_str::rt::sha256_batch_avx2(messages, lanes);
+			CHECK(lanes == digests);
+		}
+#endif
+		ct_str::rt::sha256_batch({}, {});
+	}
+
+	TEST_CASE("rt::sha512 matches ct_str::sha512")
+	{
+		CHECK(ct_str::rt::sha512("") == ct_str::sha512<"">::fwd);
+		CHECK(ct_str::rt::sha512("abc") == ct_str::sha512<"abc">::fwd);
+		CHECK(ct_str::rt::Sha512{}.update("a").update("bc").finish() == ct_str::sha512<"abc">::fwd);
+
+		const auto buf = random_bytes(3000, 21);
+		for (std::size_t len = 0; len <= 300; ++len)
+			CHECK(ct_str::rt::sha512(std::span(buf.data(), len)) == sha512_reference(buf.data(), len));
+		CHECK(ct_str::rt::sha512(std::span(buf)) == sha512_reference(buf.data(), buf.size()));
+	}
+
+	TEST_CASE("rt::sha512_batch")
+	{
+		// Lengths around the 112-byte padding boundary and the 128-byte block size, plus random ones
+		const auto								buf = random_bytes(4096, 23);
+		std::vector<std::span<const std::byte>> messages;
+		std::mt19937							gen(9);
+		for (std::size_t len : {0, 1, 111, 112, 127, 128, 129, 239, 240, 256})
+			messages.push_back(std::span(buf).subspan(len, len));
+		for (std::size_t i = 0; i < 29; ++i)
+		{
+			std::size_t len	   = gen() % 1500;
+			std::size_t offset = gen() % (buf.size() - len);
+			messages.push_back(std::span(buf).subspan(offset, len));
+		}
+
+		std::vector<ct_str::FixedBytes<64>> digests(messages.size());
+		ct_str::rt::sha512_batch(messages, digests);
+		for (std::size_t i = 0; i < messages.size(); ++i)
+			CHECK(digests[i] == sha512_reference(messages[i].data(), messages[i].size()));
+
+		std::vector<ct_str::FixedBytes<64>> single(messages.size());
+		ct_str::rt::sha512_batch_single(messages, single);
+		CHECK(single == digests);
+#if CT_STR_X86_DISPATCH
+		if (ct_str::rt::cpu_features().avx2)
+		{
+			std::vector<ct_str::FixedBytes<64>> lanes(messages.size());
+			ct_str::rt::sha512_batch_avx2(messages, lanes);
+			CHECK(lanes == digests);
+		}
+		if (ct_str::rt::cpu_features().avx512f && ct_str::rt::cpu_features().avx512bw)
+		{
+			std::vector<ct_str::FixedBytes<64>> lanes(messages.size());
+			ct_str::rt::sha512_batch_avx512(messages, lanes);
+			CHECK(lanes == digests);
+		}
+#endif
+	}
+}
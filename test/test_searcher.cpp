@@ -0,0 +1,109 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#include <cstddef>
+#include <ostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include "doctest.h"
+#include "ct_str.hpp"
+
+namespace
+{
+
+std::size_t naive_count(std::string_view hay, std::string_view needle)
+{
+	std::size_t count = 0;
+	for (std::size_t pos = hay.find(needle); pos != std::string_view::npos; pos = hay.find(needle, pos + needle.size()))
+		++count;
+	return count;
+}
+
+template <ct_str::FixedString Pattern>
+void check_against_string_view(const std::string& hay)
+{
+	using Searcher = ct_str::searcher<Pattern>;
+	const std::string_view needle(Pattern.data, Pattern.size());
+	for (std::size_t start = 0; start < hay.size(); ++start)
+	{
+		// Like ct_str::find, a pattern longer than the haystack reports the haystack size
+		const std::size_t expected =
+			needle.size() > hay.size() ? hay.size() : std::string_view(hay).find(needle, start);
+		CHECK(Searcher::find(hay, start) == expected);
+	}
+	CHECK(Searcher::rfind(hay) == std::string_view(hay).rfind(needle));
+	CHECK(Searcher::count(hay) == naive_count(hay, needle));
+}
+
+}  // namespace
+
+TEST_SUITE("Searcher")
+{
+	TEST_CASE("Same results as the compile-time functions")
+	{
+		static_assert(ct_str::searcher<"world">::find("hello world") == ct_str::find<"hello world", "world">());
+		static_assert(ct_str::searcher<"o">::find("hello world", 5) == ct_str::find<"hello world", "o", 5>());
+		static_assert(ct_str::searcher<"xyz">::find("hello world") == ct_str::find<"hello world", "xyz">());
+		static_assert(ct_str::searcher<"">::find("hello", 2) == ct_str::find<"hello", "", 2>());
+		static_assert(ct_str::searcher<"hello!">::find("hello") == ct_str::find<"hello", "hello!">());
+		static_assert(ct_str::searcher<"l">::find("hello", 5) == ct_str::find<"hello", "l", 5>());
+
+		static_assert(ct_str::searcher<"o">::rfind("hello world") == ct_str::rfind<"hello world", "o">());
+		static_assert(ct_str::searcher<"xyz">::rfind("hello world") == ct_str::rfind<"hello world", "xyz">());
+		static_assert(ct_str::searcher<"">::rfind("hello") == ct_str::rfind<"hello", "">());
+		static_assert(ct_str::searcher<"hello!">::rfind("hello") == ct_str::rfind<"hello", "hello!">());
+
+		static_assert(ct_str::searcher<"aa">::count("aaaaa") == ct_str::count_occurrences<"aaaaa", "aa">());
+		static_assert(ct_str::searcher<"ab">::count("abcabcab") == ct_str::count_occurrences<"abcabcab", "ab">());
+		static_assert(ct_str::searcher<"">::count("abc") == ct_str::count_occurrences<"abc", "">());
+	}
+
+	TEST_CASE("Critical factorization")
+	{
+		using Periodic = ct_str::searcher<"abcabcabc">;
+		static_assert(Periodic::tables.forward.periodic);
+		static_assert(Periodic::tables.forward.period == 3);
+
+		using Aperiodic = ct_str::searcher<"abcd">;
+		static_assert(!Aperiodic::tables.forward.periodic);
+
+		static_assert(ct_str::searcher<"zz">::tables.forward.shift['z'] == 0);
+		static_assert(ct_str::searcher<"zy">::tables.forward.shift['z'] == 1);
+		static_assert(ct_str::searcher<"zy">::tables.forward.shift['q'] == 2);
+	}
+
+	TEST_CASE("Adversarial inputs")
+	{
+		const std::string as(5000, 'a');
+		CHECK(ct_str::searcher<"aaaaaaaaaaaaaaaaaaab">::find(as) == ct_str::searcher<"x">::npos);
+		CHECK(ct_str::searcher<"baaaaaaaaaaaaaaaaaaa">::rfind(as) == ct_str::searcher<"x">::npos);
+		CHECK(ct_str::searcher<"aaaaaaaaaa">::count(as) == 500);
+		CHECK(ct_str::searcher<"aaaaaaaaaaaaaaaaaaab">::find(as + "b") == 4981);
+		CHECK(ct_str::searcher<"aaaaaaaaaaaaaaaaaaab">::rfind(as + "b") == 4981);
+
+		check_against_string_view<"aaab">(std::string(300, 'a') + "aab" + std::string(300, 'a') + "aaab");
+		check_against_string_view<"abaabaab">("abaabaabaabaabaabaabaabaabaabaab");
+	}
+
+	TEST_CASE("Agrees with std::string_view on random text")
+	{
+		std::mt19937 rng(5);
+		for (int round = 0; round < 20; ++round)
+		{
+			std::string hay(rng() % 400, ' ');
+			for (auto& c : hay)
+				c = "ab"[rng() % 2];
+			check_against_string_view<"a">(hay);
+			check_against_string_view<"ab">(hay);
+			check_against_string_view<"aba">(hay);
+			check_against_string_view<"abab">(hay);
+			check_against_string_view<"aabba">(hay);
+			check_against_string_view<"babbab">(hay);
+			check_against_string_view<"abaababaab">(hay);
+			check_against_string_view<"bbbbbbbb">(hay);
+		}
+	}
+}
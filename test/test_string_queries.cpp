@@ -3,10 +3,54 @@ Copyright 2025 by Kevin Hall.
 BSD-3-Clause License - See ct_str.hpp for full license text.
 */
 
+#include <cstddef>
 #include <ostream>
+#include <string_view>
 #include "doctest.h"
 #include "ct_str.hpp"
 
+namespace
+{
+
+// Count copies of Unit followed by Tail, e.g. (a)^40000 b
+template <ct_str::FixedString Unit, std::size_t Count, ct_str::FixedString Tail>
+consteval auto repeat_then()
+{
+	constexpr std::size_t len = Unit.size() * Count + Tail.size();
+	char				  buf[len + 1]{};
+	for (std::size_t i = 0; i < len; ++i)
+		buf[i] = i < Unit.size() * Count ? Unit[i % Unit.size()] : Tail[i - Unit.size() * Count];
+	return ct_str::FixedString<char, len + 1>(buf, len);
+}
+
+constexpr std::size_t naive_count(std::string_view str, std::string_view pat)
+{
+	std::size_t count = 0;
+	if (pat.empty())
+		return 0;
+	for (std::size_t pos = str.find(pat); pos != std::string_view::npos; pos = str.find(pat, pos + pat.size()))
+		++count;
+	return count;
+}
+
+template <ct_str::FixedString Str, ct_str::FixedString Pattern>
+constexpr bool agrees_with_string_view()
+{
+	constexpr std::string_view str(Str.data, Str.size());
+	constexpr std::string_view pat(Pattern.data, Pattern.size());
+	constexpr std::size_t	   npos = std::string_view::npos;
+	bool					   ok	= ct_str::rfind<Str, Pattern>() == (pat.empty() ? npos : str.rfind(pat));
+	ok = ok && ct_str::count_occurrences<Str, Pattern>() == naive_count(str, pat);
+	if (!pat.empty() && pat.size() <= str.size())
+	{
+		ok = ok && ct_str::find<Str, Pattern>() == str.find(pat);
+		ok = ok && ct_str::find<Str, Pattern, 3>() == (str.size() > 3 ? str.find(pat, 3) : str.size());
+	}
+	return ok;
+}
+
+}  // namespace
+
 TEST_SUITE("String Queries")
 {
 	TEST_CASE("at")
@@ -196,4 +240,46 @@ TEST_SUITE("String Queries")
 		// Case sensitive
 		static_assert(ct_str::compare<"ABC", "abc">() < 0);	 // 'A' < 'a' in ASCII
 	}
-}
\ No newline at end of file
+
+	TEST_CASE("Periodic patterns")
+	{
+		static_assert(agrees_with_string_view<"abababababc", "ababc">());
+		static_assert(agrees_with_string_view<"aabaabaaab", "aab">());
+		static_assert(agrees_with_string_view<"aaaaaa", "aa">());
+		static_assert(agrees_with_string_view<"aaaaaa", "aaa">());
+		static_assert(agrees_with_string_view<"abcabcabd", "abcabd">());
+		static_assert(agrees_with_string_view<"xyzxyzxy", "zxy">());
+		static_assert(agrees_with_string_view<"abaabaabaab", "abaab">());
+		static_assert(agrees_with_string_view<"mississippi", "issi">());
+		static_assert(agrees_with_string_view<"mississippi", "ssippi">());
+		static_assert(agrees_with_string_view<"mississippi", "q">());
+		static_assert(agrees_with_string_view<"ab", "abc">());
+		static_assert(agrees_with_string_view<"abc", "">());
+	}
+
+	// Long repetitive inputs take O(n * m) steps with nested-loop matching; the KMP core keeps them O(n + m)
+	TEST_CASE("Long repetitive inputs")
+	{
+		constexpr auto			   text		= repeat_then<"a", 40000, "b">();
+		constexpr auto			   needle	= repeat_then<"a", 200, "b">();
+		constexpr auto			   periodic = repeat_then<"ab", 20000, "abc">();
+		constexpr std::size_t	   npos		= std::string_view::npos;
+
+		static_assert(ct_str::find<text, needle>() == 40000 - 200);
+		static_assert(ct_str::rfind<text, needle>() == 40000 - 200);
+		static_assert(ct_str::find<text, "aaab">() == 40000 - 3);
+		static_assert(ct_str::rfind<text, "baaa">() == npos);
+		static_assert(ct_str::count_occurrences<text, "aaa">() == 40000 / 3);
+		static_assert(ct_str::count_n_occurrences<text, "aa", 7>() == 7);
+		static_assert(ct_str::contains<periodic, "ababc">());
+		static_assert(ct_str::find<periodic, "ababababc">() == 40000 - 6);
+		static_assert(ct_str::rfind<periodic, "abab">() == 40000 - 2);
+		static_assert(ct_str::count_occurrences<periodic, "abab">() == 10000);
+
+		using Replaced = ct_str::replace_all<text, "aaaa", "x">;
+		static_assert(Replaced::view().size() == 10001);
+		static_assert(Replaced::view().substr(9998) == "xxb");
+		static_assert(ct_str::replace_n<periodic, "ab", "", 19999>::view() == "ababc");
+		CHECK(ct_str::pipe<periodic, ct_str::op::replace_all<"abab", "">>::view() == "abc");
+	}
+}
@@ -0,0 +1,104 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#include <ostream>
+#include <string>
+#include "doctest.h"
+#include "ct_str.hpp"
+
+TEST_SUITE("String Switch")
+{
+	TEST_CASE("Returns the case index or the case count")
+	{
+		static_assert(ct_str::string_switch<"GET", "PUT", "DELETE">("GET") == 0);
+		static_assert(ct_str::string_switch<"GET", "PUT", "DELETE">("PUT") == 1);
+		static_assert(ct_str::string_switch<"GET", "PUT", "DELETE">("DELETE") == 2);
+		static_assert(ct_str::string_switch<"GET", "PUT", "DELETE">("PATCH") == 3);
+
+		const std::string method = "DELETE";
+		CHECK(ct_str::string_switch<"GET", "PUT", "DELETE">(method) == 2);
+		CHECK(ct_str::string_switch<"GET", "PUT", "DELETE">("") == 3);
+		CHECK(ct_str::string_switch<"GET", "PUT", "DELETE">("get") == 3);
+		CHECK(ct_str::string_switch<"GET", "PUT", "DELETE">("DELETED") == 3);
+	}
+
+	TEST_CASE("Same-length cases and near misses")
+	{
+		// Every case has length 4; they differ at various positions
+		using Commands = ct_str::StringSwitch<"ping", "pong", "pink", "sing", "ring", "rung", "king">;
+		static_assert(Commands::no_match == 7);
+		static_assert(Commands::index_of<"rung">() == 5);
+
+		const char* cases[] = {"ping", "pong", "pink", "sing", "ring", "rung", "king"};
+		for (std::size_t i = 0; i < 7; ++i)
+			CHECK(Commands::match(cases[i]) == i);
+
+		// Right discriminating character, wrong elsewhere
+		CHECK(Commands::match("pint") == Commands::no_match);
+		CHECK(Commands::match("kink") == Commands::no_match);
+		CHECK(Commands::match("xing") == Commands::no_match);
+	}
+
+	TEST_CASE("Regular case sets that no single position separates")
+	{
+		// Two positions still leave runs of two entries that the word compare must tell apart
+		using Grid = ct_str::StringSwitch<"x00", "x01", "x10", "x11", "y00", "y01", "y10", "y11">;
+		const char* cases[] = {"x00", "x01", "x10", "x11", "y00", "y01", "y10", "y11"};
+		for (std::size_t i = 0; i < 8; ++i)
+			CHECK(Grid::match(cases[i]) == i);
+		CHECK(Grid::match("x02") == Grid::no_match);
+		CHECK(Grid::match("z00") == Grid::no_match);
+		CHECK(Grid::match("x0") == Grid::no_match);
+	}
+
+	TEST_CASE("Word compares at every length")
+	{
+		using Lengths = ct_str::StringSwitch<"", "a", "ab", "abc", "abcd", "abcde", "abcdefg", "abcdefgh", "abcdefghi",
+											 "abcdefghijklmnop", "abcdefghijklmnopq">;
+		const std::string full = "abcdefghijklmnopq";
+		const std::size_t lens[] = {0, 1, 2, 3, 4, 5, 7, 8, 9, 16, 17};
+		for (std::size_t i = 0; i < 11; ++i)
+		{
+			std::string s = full.substr(0, lens[i]);
+			CHECK(Lengths::match(s) == i);
+
+			// Flip each character in turn; every variant must miss
+			for (std::size_t j = 0; j < s.size(); ++j)
+			{
+				std::string t = s;
+				t[j]		  = 'Z';
+				CHECK(Lengths::match(t) == Lengths::no_match);
+			}
+		}
+		CHECK(Lengths::match("abcdef") == Lengths::no_match);
+	}
+
+	TEST_CASE("Usable as case labels")
+	{
+		using Verbs = ct_str::StringSwitch<"start", "stop", "status">;
+		auto describe = [](std::string_view verb) -> std::string {
+			switch (Verbs::match(verb))
+			{
+			case Verbs::index_of<"start">():
+				return "starting";
+			case Verbs::index_of<"stop">():
+				return "stopping";
+			case Verbs::index_of<"status">():
+				return "ok";
+			default:
+				return "unknown";
+			}
+		};
+		CHECK(describe("stop") == "stopping");
+		CHECK(describe("status") == "ok");
+		CHECK(describe("restart") == "unknown");
+	}
+
+	TEST_CASE("Wide character cases")
+	{
+		static_assert(ct_str::string_switch<u"alpha", u"beta", u"gamma">(u"beta") == 1);
+		static_assert(ct_str::string_switch<u"alpha", u"beta", u"gamma">(u"delta") == 3);
+	}
+}
@@ -0,0 +1,101 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#include <cstddef>
+#include <cstring>
+#include <ostream>
+#include <string_view>
+#include "doctest.h"
+#include "ct_str.hpp"
+
+TEST_SUITE("StringTable")
+{
+	TEST_CASE("Views through offsets")
+	{
+		using Messages = ct_str::string_table<"ok", "not found", "", "timeout">;
+		static_assert(Messages::size() == 4);
+		static_assert(Messages::view(0) == "ok");
+		static_assert(Messages::view(1) == "not found");
+		static_assert(Messages::view(2).empty());
+		static_assert(Messages::view(3) == "timeout");
+		static_assert(Messages::length(1) == 9);
+		static_assert(Messages::blob_size() == 2 + 9 + 0 + 7 + 4);
+
+		CHECK(std::strcmp(Messages::c_str(1), "not found") == 0);
+		CHECK(std::strcmp(Messages::c_str(2), "") == 0);
+		CHECK(Messages::c_str(3)[Messages::length(3)] == '\0');
+		CHECK(Messages::view(0).data() == Messages::data());
+	}
+
+	TEST_CASE("Strings share one blob")
+	{
+		using Table = ct_str::string_table<"alpha", "beta", "gamma">;
+		CHECK(std::string_view(Table::data(), Table::blob_size()) == std::string_view("alpha\0beta\0gamma\0", 17));
+		for (std::size_t i = 0; i < Table::size(); ++i)
+		{
+			CHECK(Table::c_str(i) >= Table::data());
+			CHECK(Table::c_str(i) + Table::length(i) < Table::data() + Table::blob_size());
+		}
+	}
+
+	TEST_CASE("Index of a string")
+	{
+		using Table = ct_str::string_table<"red", "green", "blue", "green">;
+		static_assert(Table::index_of<"red">() == 0);
+		static_assert(Table::index_of<"green">() == 1);
+		static_assert(Table::index_of<"blue">() == 2);
+		CHECK(Table::view(Table::index_of<"blue">()) == "blue");
+	}
+
+	TEST_CASE("Wide characters")
+	{
+		using Table = ct_str::string_table<L"one", L"two">;
+		static_assert(Table::view(1) == L"two");
+		CHECK(Table::c_str(0)[3] == L'\0');
+	}
+}
+
+TEST_SUITE("SuffixTable")
+{
+	TEST_CASE("Suffixes share storage")
+	{
+		using Errors = ct_str::suffix_table<"error", "io_error", "disk_io_error">;
+		static_assert(Errors::blob_size() == 14);
+		static_assert(Errors::view(0) == "error");
+		static_assert(Errors::view(1) == "io_error");
+		static_assert(Errors::view(2) == "disk_io_error");
+		CHECK(Errors::c_str(0) == Errors::c_str(2) + 8);
+		CHECK(Errors::c_str(1) == Errors::c_str(2) + 5);
+		CHECK(std::strcmp(Errors::c_str(0), "error") == 0);
+	}
+
+	TEST_CASE("Unrelated strings, duplicates and the empty string")
+	{
+		using Table = ct_str::suffix_table<"read", "", "write", "read", "ad", "rite", "x">;
+		static_assert(Table::blob_size() == 5 + 6 + 2);
+		static_assert(Table::view(0) == "read");
+		static_assert(Table::view(1).empty());
+		static_assert(Table::view(2) == "write");
+		static_assert(Table::view(3) == "read");
+		static_assert(Table::view(4) == "ad");
+		static_assert(Table::view(5) == "rite");
+		static_assert(Table::view(6) == "x");
+		static_assert(Table::index_of<"rite">() == 5);
+		CHECK(Table::c_str(0) == Table::c_str(3));
+		CHECK(*Table::c_str(1) == '\0');
+		for (std::size_t i = 0; i < Table::size(); ++i)
+			CHECK(Table::c_str(i)[Table::length(i)] == '\0');
+	}
+
+	TEST_CASE("Same strings as string_table")
+	{
+		using Plain	 = ct_str::string_table<"on_open", "open", "pen", "on_close", "close", "lose", "se", "on">;
+		using Merged = ct_str::suffix_table<"on_open", "open", "pen", "on_close", "close", "lose", "se", "on">;
+		static_assert(Merged::blob_size() == 8 + 9 + 3);
+		static_assert(Merged::blob_size() < Plain::blob_size());
+		for (std::size_t i = 0; i < Plain::size(); ++i)
+			CHECK(Merged::view(i) == Plain::view(i));
+	}
+}
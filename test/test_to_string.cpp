@@ -0,0 +1,258 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+#include <bit>
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <ostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include "doctest.h"
+#include "ct_str.hpp"
+
+namespace
+{
+
+// std::to_chars text, padded like ct_str's writers
+template <typename T>
+std::string reference(T value, int base, std::size_t width = 0, char fill = '0')
+{
+	char buf[80];
+	auto result = std::to_chars(buf, buf + sizeof(buf), value, base);
+	std::string text(buf, result.ptr);
+	if (text.size() < width)
+	{
+		const bool		  zero_after_sign = fill == '0' && text[0] == '-';
+		const std::size_t at			  = zero_after_sign ? 1 : 0;
+		text.insert(at, width - text.size(), fill);
+	}
+	return text;
+}
+
+template <unsigned Base, typename T>
+void check_runtime(T value, std::size_t width = 0, char fill = '0')
+{
+	char			 buf[80];
+	const std::string expected = reference(value, static_cast<int>(Base), width, fill);
+	const char*		 end	  = ct_str::rt::to_chars<Base>(buf, value, width, fill);
+	CHECK(std::string_view(buf, static_cast<std::size_t>(end - buf)) == expected);
+	if (width == 0)
+		CHECK(expected.size() <= ct_str::rt::to_chars_max<T, Base>);
+}
+
+template <typename T>
+void check_shortest(T value)
+{
+	char		   expected[64];
+	const auto	   result = std::to_chars(expected, expected + sizeof(expected), value);
+	char		   buf[64];
+	const char*	   end	  = ct_str::rt::to_chars(buf, value);
+	std::string_view text(buf, static_cast<std::size_t>(end - buf));
+	CHECK(text == std::string_view(expected, static_cast<std::size_t>(result.ptr - expected)));
+	CHECK(text.size() <= ct_str::rt::to_chars_max<T>);
+
+	// Reads back as the same value
+	const std::string copy(text);
+	if constexpr (std::is_same_v<T, float>)
+		CHECK(std::strtof(copy.c_str(), nullptr) == value);
+	else
+		CHECK(std::strtod(copy.c_str(), nullptr) == value);
+}
+
+template <typename T>
+void check_fixed(T value, int precision)
+{
+	char expected[1200];
+	const int len = std::snprintf(expected, sizeof(expected), "%.*f", precision, static_cast<double>(value));
+	char		buf[1200];
+	const char* end = ct_str::rt::to_chars_fixed(buf, value, static_cast<std::size_t>(precision));
+	CHECK(std::string_view(buf, static_cast<std::size_t>(end - buf)) ==
+		  std::string_view(expected, static_cast<std::size_t>(len)));
+	CHECK(static_cast<std::size_t>(end - buf) <= ct_str::fixed_max_length<T>(static_cast<std::size_t>(precision)));
+}
+
+}  // namespace
+
+TEST_SUITE("To String")
+{
+	TEST_CASE("Compile-time constants")
+	{
+		static_assert(ct_str::to_string<0>::view() == "0");
+		static_assert(ct_str::to_string<8080>::view() == "8080");
+		static_assert(ct_str::to_string<-42>::view() == "-42");
+		static_assert(ct_str::to_string<std::numeric_limits<int64_t>::min()>::view() == "-9223372036854775808");
+		static_assert(ct_str::to_string<std::numeric_limits<uint64_t>::max()>::view() == "18446744073709551615");
+		static_assert(ct_str::to_string<255, 16>::view() == "ff");
+		static_assert(ct_str::to_string<0xdeadbeefu, 16>::view() == "deadbeef");
+		static_assert(ct_str::to_string<5, 2>::view() == "101");
+		static_assert(ct_str::to_string<511, 8>::view() == "777");
+		static_assert(ct_str::to_string<35, 36>::view() == "z");
+		static_assert(ct_str::to_string<-100, 3>::view() == "-10201");
+		static_assert(ct_str::to_string<std::numeric_limits<int8_t>::min(), 2>::view() == "-10000000");
+	}
+
+	TEST_CASE("Width and fill")
+	{
+		static_assert(ct_str::to_string<7, 10, 3>::view() == "007");
+		static_assert(ct_str::to_string<-42, 10, 5>::view() == "-0042");
+		static_assert(ct_str::to_string<-42, 10, 5, ' '>::view() == "  -42");
+		static_assert(ct_str::to_string<12345, 10, 3>::view() == "12345");
+		static_assert(ct_str::to_string<0xab, 16, 8>::view() == "000000ab");
+		static_assert(ct_str::to_string<1, 2, 4, '.'>::view() == "...1");
+
+		static_assert(ct_str::to_string<ct_str::crc32<"boot">(), 16, 8>::view().size() == 8);
+		CHECK(ct_str::to_string<ct_str::crc32<"boot">(), 16, 8>::view() == reference(ct_str::crc32<"boot">(), 16, 8));
+	}
+
+	TEST_CASE("Spliced into other strings")
+	{
+		using port = ct_str::to_string<8080>;
+		using url  = ct_str::append<"http://localhost:", port::fwd, "/">;
+		static_assert(url::view() == "http://localhost:8080/");
+		static_assert(std::string_view(ct_str::to_string<1, 10, 2>::c_str()) == "01");
+	}
+
+	TEST_CASE("Runtime output matches std::to_chars")
+	{
+		check_runtime<10>(0);
+		check_runtime<16>(0);
+		check_runtime<2>(0);
+		check_runtime<10>(std::numeric_limits<int64_t>::min());
+		check_runtime<16>(std::numeric_limits<int64_t>::min());
+		check_runtime<2>(std::numeric_limits<int64_t>::min());
+		check_runtime<16>(std::numeric_limits<uint64_t>::max());
+		check_runtime<2>(std::numeric_limits<uint64_t>::max());
+		check_runtime<36>(std::numeric_limits<uint64_t>::max());
+		check_runtime<8>(std::numeric_limits<int8_t>::min());
+		check_runtime<16>(uint16_t{0x0f00});
+
+		std::mt19937_64 rng(22);
+		for (int i = 0; i < 1000; ++i)
+		{
+			const auto value = static_cast<int64_t>(rng()) >> (i % 64);
+			check_runtime<10>(value);
+			check_runtime<16>(value);
+			check_runtime<16>(static_cast<uint64_t>(value));
+			check_runtime<2>(value);
+			check_runtime<8>(value);
+			check_runtime<7>(value);
+			check_runtime<32>(static_cast<uint32_t>(value));
+			check_runtime<10>(value, i % 24, i % 3 ? '0' : ' ');
+			check_runtime<16>(value, i % 24, i % 3 ? '0' : '*');
+		}
+	}
+
+	TEST_CASE("Runtime output matches the compile-time text")
+	{
+		char buf[40];
+		CHECK(ct_str::rt::to_string(buf, -42, 5) == ct_str::to_string<-42, 10, 5>::view());
+		CHECK(ct_str::rt::to_string(buf, -42, 5, ' ') == ct_str::to_string<-42, 10, 5, ' '>::view());
+		CHECK(ct_str::rt::to_string<16>(buf, 0xdeadbeefu) == ct_str::to_string<0xdeadbeefu, 16>::view());
+		CHECK(ct_str::rt::to_string<16>(buf, 0xab, 8) == ct_str::to_string<0xab, 16, 8>::view());
+		CHECK(ct_str::rt::to_string<2>(buf, 5) == ct_str::to_string<5, 2>::view());
+
+		// Decimal needs less room than binary; a width beyond the array is cut down to the array
+		static_assert(ct_str::rt::to_chars_max<int> == 11 && ct_str::rt::to_chars_max<int, 2> == 33);
+		static_assert(ct_str::rt::to_chars_max<uint64_t, 16> == 16);
+		char small[12];
+		CHECK(ct_str::rt::to_string(small, 1, 100) == "000000000001");
+	}
+
+	TEST_CASE("Shortest floating-point constants")
+	{
+		static_assert(ct_str::to_string<0.1>::view() == "0.1");
+		static_assert(ct_str::to_string<0.3f>::view() == "0.3");
+		static_assert(ct_str::to_string<1.0>::view() == "1");
+		static_assert(ct_str::to_string<-0.0>::view() == "-0");
+		static_assert(ct_str::to_string<100.0>::view() == "100");
+		static_assert(ct_str::to_string<123456.0>::view() == "123456");
+		static_assert(ct_str::to_string<1e22>::view() == "1e+22");
+		static_assert(ct_str::to_string<1e-7>::view() == "1e-07");
+		static_assert(ct_str::to_string<0.001>::view() == "0.001");
+		static_assert(ct_str::to_string<5e-324>::view() == "5e-324");
+		static_assert(ct_str::to_string<1.7976931348623157e308>::view() == "1.7976931348623157e+308");
+		static_assert(ct_str::to_string<2.2250738585072014e-308>::view() == "2.2250738585072014e-308");
+		static_assert(ct_str::to_string<1152921504606846976.0>::view() == "1152921504606846976");
+		static_assert(ct_str::to_string<std::numeric_limits<double>::infinity()>::view() == "inf");
+		static_assert(ct_str::to_string<-std::numeric_limits<float>::infinity()>::view() == "-inf");
+
+		static_assert(ct_str::to_string<-1.5, 10, 6>::view() == "-001.5");
+		static_assert(ct_str::to_string<-1.5, 10, 6, ' '>::view() == "  -1.5");
+
+		using config = ct_str::append<"gain=", ct_str::to_string<0.75>::fwd, ";limit=", ct_str::to_string<1e-9>::fwd>;
+		static_assert(config::view() == "gain=0.75;limit=1e-09");
+	}
+
+	TEST_CASE("Fixed-precision constants")
+	{
+		static_assert(ct_str::to_fixed<0.1>::view() == "0.100000");
+		static_assert(ct_str::to_fixed<3.14159, 2>::view() == "3.14");
+		static_assert(ct_str::to_fixed<0.125, 2>::view() == "0.12");	// ties go to even
+		static_assert(ct_str::to_fixed<0.375, 2>::view() == "0.38");
+		static_assert(ct_str::to_fixed<2.5, 0>::view() == "2");
+		static_assert(ct_str::to_fixed<999.999, 2>::view() == "1000.00");
+		static_assert(ct_str::to_fixed<-0.001, 2>::view() == "-0.00");
+		static_assert(ct_str::to_fixed<0.1, 20>::view() == "0.10000000000000000555");
+		static_assert(ct_str::to_fixed<1e21f, 1>::view() == "1000000020040877342720.0");
+		static_assert(ct_str::to_fixed<5e-324, 330>::view().substr(320) == "000004940656");
+		static_assert(ct_str::to_fixed<1.7976931348623157e308, 0>::view().size() == 309);
+	}
+
+	TEST_CASE("Runtime floating-point output matches std::to_chars and printf")
+	{
+		for (double d : {0.1, 0.3, 1.0, 1e22, 1e23, 5e-324, 1.7976931348623157e308, 2.2250738585072014e-308, 123456.0,
+						 1e15, 1e16, 1e17, 9007199254740993.0, -0.0, 0.001, 1e-5, 1e-7, 100.0, 1e21, 123e18})
+		{
+			check_shortest(d);
+			check_shortest(static_cast<float>(d));
+			for (int precision : {0, 1, 2, 3, 6, 17, 30})
+				check_fixed(d, precision);
+		}
+		for (double d : {0.5, 1.5, 2.5, 0.125, 0.375, 2.675, 1e-300, 9.995, 0.0})
+		{
+			for (int precision = 0; precision < 6; ++precision)
+				check_fixed(d, precision);
+		}
+		check_shortest(std::numeric_limits<double>::infinity());
+		check_shortest(-std::numeric_limits<float>::infinity());
+		check_fixed(5e-324, 1074);
+
+		std::mt19937_64 rng(23);
+		for (int i = 0; i < 20000; ++i)
+		{
+			const uint64_t bits = rng();
+			const double   d	= std::bit_cast<double>(bits);
+			const float	   f	= std::bit_cast<float>(static_cast<uint32_t>(bits));
+			if (d == d)
+				check_shortest(d);
+			if (f == f)
+				check_shortest(f);
+
+			// Values with few significant bits, where ties and short digit strings are common
+			const double small = static_cast<double>(static_cast<int64_t>(rng() % 2'000'001) - 1'000'000) /
+								 static_cast<double>(1 << (rng() % 24));
+			check_shortest(small);
+			check_fixed(small, static_cast<int>(rng() % 12));
+			if (i % 20 == 0)
+				check_fixed(d == d ? d : 0.0, static_cast<int>(rng() % 40));
+		}
+	}
+
+	TEST_CASE("Runtime floating-point output matches the compile-time text")
+	{
+		char buf[64];
+		CHECK(ct_str::rt::to_string(buf, 0.1) == ct_str::to_string<0.1>::view());
+		CHECK(ct_str::rt::to_string(buf, 1e22) == ct_str::to_string<1e22>::view());
+		CHECK(ct_str::rt::to_string(buf, 0.3f) == ct_str::to_string<0.3f>::view());
+		CHECK(ct_str::rt::to_string(buf, -1.5, 6) == ct_str::to_string<-1.5, 10, 6>::view());
+		CHECK(ct_str::rt::to_string(buf, -1.5, 6, ' ') == ct_str::to_string<-1.5, 10, 6, ' '>::view());
+		CHECK(std::string_view(buf, static_cast<std::size_t>(ct_str::rt::to_chars_fixed(buf, 999.999, 2) - buf)) ==
+			  ct_str::to_fixed<999.999, 2>::view());
+	}
+}
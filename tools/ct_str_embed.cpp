@@ -0,0 +1,207 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+// Generates a header that embeds one file as a StringStore (--text) or ByteStore (--bytes), together with its
+// length, crc32, sha256 and an ETag. Invoked by ct_str_embed() in cmake/CtStrEmbed.cmake:
+//
+//	ct_str_embed_gen --text|--bytes --name index_html --namespace assets --path web/index.html
+//	                 --in /src/web/index.html --out /build/.../index_html.hpp [--chunk 16384]
+
+#include "ct_str_runtime.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+namespace
+{
+
+struct Options
+{
+	bool		text = false;
+	std::string name;
+	std::string ns = "assets";
+	std::string path;
+	std::string in;
+	std::string out;
+	std::size_t chunk = 16384;
+};
+
+[[noreturn]] void fail(const std::string& message)
+{
+	std::fprintf(stderr, "ct_str_embed_gen: %s\n", message.c_str());
+	std::exit(1);
+}
+
+Options parse_options(int argc, char** argv)
+{
+	Options opt;
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string arg = argv[i];
+		if (arg == "--text" || arg == "--bytes")
+		{
+			opt.text = arg == "--text";
+			continue;
+		}
+		if (i + 1 >= argc)
+			fail("missing value for " + arg);
+		const std::string value = argv[++i];
+		if (arg == "--name")
+			opt.name = value;
+		else if (arg == "--namespace")
+			opt.ns = value;
+		else if (arg == "--path")
+			opt.path = value;
+		else if (arg == "--in")
+			opt.in = value;
+		else if (arg == "--out")
+			opt.out = value;
+		else if (arg == "--chunk")
+			opt.chunk = std::strtoul(value.c_str(), nullptr, 10);
+		else
+			fail("unknown option " + arg);
+	}
+	if (opt.name.empty() || opt.in.empty() || opt.out.empty())
+		fail("usage: ct_str_embed_gen --text|--bytes --name NAME [--namespace NS] [--path PATH] --in FILE --out "
+			 "HEADER [--chunk BYTES]");
+	if (opt.chunk == 0)
+		fail("--chunk must be positive");
+	if (opt.path.empty())
+		opt.path = opt.in;
+	return opt;
+}
+
+// A string literal holding str, with every character outside printable ASCII written as a three-digit octal
+// escape so that it cannot run into the next character. Long literals are split after newlines and every
+// 96 characters.
+std::string string_literal(std::string_view str, const char* indent)
+{
+	std::string out = "\"";
+	std::size_t run = 0;
+	for (std::size_t i = 0; i < str.size(); ++i)
+	{
+		const auto c = static_cast<unsigned char>(str[i]);
+		if (c == '"' || c == '\\')
+			out += {'\\', static_cast<char>(c)};
+		else if (c == '?')
+			out += "\\?";  // no trigraphs
+		else if (c >= 0x20 && c < 0x7F)
+			out += static_cast<char>(c);
+		else
+		{
+			char escape[5];
+			std::snprintf(escape, sizeof(escape), "\\%03o", c);
+			out += escape;
+		}
+		if ((c == '\n' || ++run == 96) && i + 1 < str.size())
+		{
+			out += "\"\n";
+			out += indent;
+			out += "\"";
+			run = 0;
+		}
+	}
+	return out + "\"";
+}
+
+std::string byte_list(const uint8_t* data, std::size_t len, const char* indent)
+{
+	std::string out;
+	char		byte[8];
+	for (std::size_t i = 0; i < len; ++i)
+	{
+		if (i % 16 != 0)
+			out += ", ";
+		else
+		{
+			if (i != 0)
+				out += ",\n";
+			out += indent;
+		}
+		std::snprintf(byte, sizeof(byte), "0x%02x", data[i]);
+		out += byte;
+	}
+	return out;
+}
+
+std::string hex(const uint8_t* data, std::size_t len)
+{
+	static constexpr char digits[] = "0123456789abcdef";
+	std::string			  out;
+	for (std::size_t i = 0; i < len; ++i)
+		out += {digits[data[i] >> 4], digits[data[i] & 0x0F]};
+	return out;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+	const Options opt = parse_options(argc, argv);
+
+	std::ifstream in(opt.in, std::ios::binary);
+	if (!in)
+		fail("cannot read " + opt.in);
+	const std::string content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+	if (!opt.text && content.empty())
+		fail(opt.in + " is empty; a ByteStore cannot hold zero bytes (embed it as TEXT)");
+
+	const uint32_t				 crc	= ct_str::rt::crc32(std::string_view(content));
+	const ct_str::FixedBytes<32> digest = ct_str::rt::sha256(std::string_view(content));
+
+	// An empty text file still gets one (empty) chunk
+	const std::size_t chunks = content.empty() ? 1 : (content.size() + opt.chunk - 1) / opt.chunk;
+
+	std::ostringstream os;
+	os << "// Generated by ct_str_embed from " << opt.path << "; do not edit.\n\n"
+	   << "#pragma once\n\n"
+	   << "#include \"ct_str.hpp\"\n"
+	   << "#include <cstddef>\n"
+	   << "#include <cstdint>\n\n"
+	   << "namespace " << opt.ns << "\n{\n\n"
+	   << "namespace embed_chunks\n{\n";
+	for (std::size_t c = 0; c < chunks; ++c)
+	{
+		const std::string_view chunk = std::string_view(content).substr(c * opt.chunk, opt.chunk);
+		if (opt.text)
+			os << "inline constexpr char " << opt.name << '_' << c << "[] =\n\t" << string_literal(chunk, "\t")
+			   << ";\n";
+		else
+			os << "inline constexpr uint8_t " << opt.name << '_' << c << "[] = {\n"
+			   << byte_list(reinterpret_cast<const uint8_t*>(chunk.data()), chunk.size(), "\t") << "};\n";
+	}
+	os << "}  // namespace embed_chunks\n\n";
+
+	std::string parts;
+	for (std::size_t c = 0; c < chunks; ++c)
+		parts += (c == 0 ? "embed_chunks::" : ", embed_chunks::") + opt.name + '_' + std::to_string(c);
+	const char* data = opt.text ? "ct_str::StringStore<ct_str::embed_text" : "ct_str::ByteStore<ct_str::embed_bytes";
+
+	char crc_text[16];
+	std::snprintf(crc_text, sizeof(crc_text), "0x%08x", crc);
+	os << "// " << opt.path << ", " << content.size() << " bytes\n"
+	   << "struct " << opt.name << "\n{\n"
+	   << "\tusing data = " << data << '(' << parts << ")>;\n"
+	   << "\tusing path = ct_str::StringStore<" << string_literal(opt.path, "\t\t") << ">;\n"
+	   << "\tusing sha256 = ct_str::ByteStore<ct_str::FixedBytes<32>({\n"
+	   << byte_list(digest.data, digest.size(), "\t\t") << "})>;\n"
+	   << "\tusing etag = ct_str::StringStore<\"\\\"" << hex(digest.data, digest.size()) << "\\\"\">;\n\n"
+	   << "\tstatic constexpr std::size_t size = " << content.size() << ";\n"
+	   << "\tstatic constexpr uint32_t crc32 = " << crc_text << ";\n"
+	   << "};\n\n"
+	   << "}  // namespace " << opt.ns << "\n";
+
+	std::ofstream out(opt.out, std::ios::binary);
+	out << os.str();
+	if (!out)
+		fail("cannot write " + opt.out);
+	return 0;
+}
@@ -0,0 +1,108 @@
+/*
+Copyright 2025 by Kevin Hall.
+BSD-3-Clause License - See ct_str.hpp for full license text.
+*/
+
+// Prints a binary log written by ct_str::binlog as text, one record per line in timestamp order:
+//
+//	ct_str_log_decode app.ctlog
+//	     0.000125 [t0] request 17 took 42 us
+//
+// Options:
+//	--ticks		show raw timestamps instead of seconds since the logger started
+//	--thread N	only records from thread N (numbered in the order threads first logged)
+//	--messages	list the message table (ID, argument layout, text) instead of the records
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "details/binary_log.hpp"
+
+namespace
+{
+
+int usage()
+{
+	std::fputs("usage: ct_str_log_decode [--ticks] [--thread N] [--messages] FILE\n", stderr);
+	return 2;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+	bool		raw_ticks	  = false;
+	bool		list_messages = false;
+	long		only_thread	  = -1;
+	const char* path		  = nullptr;
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string_view arg = argv[i];
+		if (arg == "--ticks")
+			raw_ticks = true;
+		else if (arg == "--messages")
+			list_messages = true;
+		else if (arg == "--thread" && i + 1 < argc)
+			only_thread = std::strtol(argv[++i], nullptr, 10);
+		else if (path == nullptr && !arg.starts_with("--"))
+			path = argv[i];
+		else
+			return usage();
+	}
+	if (path == nullptr)
+		return usage();
+
+	std::ifstream in(path, std::ios::binary);
+	if (!in)
+	{
+		std::fprintf(stderr, "ct_str_log_decode: cannot open %s\n", path);
+		return 1;
+	}
+	ct_str::binlog::LogReader reader;
+	if (!reader.parse(std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>())))
+	{
+		std::fprintf(stderr, "ct_str_log_decode: %s: %s\n", path, reader.error().c_str());
+		return 1;
+	}
+
+	if (list_messages)
+	{
+		std::vector<uint32_t> ids;
+		for (const auto& entry : reader.messages())
+			ids.push_back(entry.first);
+		std::sort(ids.begin(), ids.end());
+		for (const uint32_t id : ids)
+		{
+			if (const auto* message = reader.message(id))
+				std::printf("%08x %-8s %s\n", static_cast<unsigned>(id), message->layout.c_str(), message->text.c_str());
+			else
+				std::printf("%08x %-8s <ambiguous: messages with different text share this ID>\n",
+							static_cast<unsigned>(id), "?");
+		}
+		return 0;
+	}
+
+	for (const auto& record : reader.records())
+	{
+		if (only_thread >= 0 && record.thread != static_cast<uint32_t>(only_thread))
+			continue;
+		const std::string text = reader.text(record);
+		if (raw_ticks)
+			std::printf("%20llu [t%u] %s\n", static_cast<unsigned long long>(record.time), record.thread, text.c_str());
+		else
+			std::printf("%13.6f [t%u] %s\n", reader.seconds(record), record.thread, text.c_str());
+	}
+	for (const uint32_t id : reader.collisions())
+		std::fprintf(stderr, "ct_str_log_decode: messages with different text share ID %08x\n",
+					 static_cast<unsigned>(id));
+	if (reader.dropped() != 0)
+		std::fprintf(stderr, "ct_str_log_decode: %llu records were dropped because a ring was full\n",
+					 static_cast<unsigned long long>(reader.dropped()));
+	return 0;
+}